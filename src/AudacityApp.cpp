@@ -30,6 +30,7 @@ It handles initialization and termination by subclassing wxApp.
 #include <wx/bitmap.h>
 #include <wx/docview.h>
 #include <wx/event.h>
+#include <wx/stopwatch.h>
 #include <wx/ipc.h>
 #include <wx/log.h>
 #include <wx/window.h>
@@ -1197,6 +1198,19 @@ AudacityApp::~AudacityApp()
 // main frame
 bool AudacityApp::OnInit()
 {
+   // Startup phase timing: each checkpoint logs its delta, so a slow
+   // launch names its culprit (theme decode, plugin registry, device
+   // scan, project creation) instead of being one opaque wait.  Debug
+   // log only; costs one clock read per phase.
+   wxStopWatch startupWatch;
+   long startupLast = 0;
+   const auto startupCheckpoint = [&](const wxChar *phase) {
+      const long now = startupWatch.Time();
+      wxLogDebug(wxT("Startup: %s took %ld ms (total %ld ms)"),
+         phase, now - startupLast, now);
+      startupLast = now;
+   };
+
    // JKC: ANSWER-ME: Who actually added the event loop guarantor?
    // Although 'blame' says Leland, I think it came from a donated patch.
 
@@ -1382,11 +1396,17 @@ bool AudacityApp::OnInit()
    InitCommandHandler();
 
    // Initialize the PluginManager
+   startupCheckpoint(wxT("pre-plugin initialization"));
+
    PluginManager::Get().Initialize();
 
+   startupCheckpoint(wxT("plugin registry"));
+
    // Initialize the ModuleManager, including loading found modules
    ModuleManager::Get().Initialize(*mCmdHandler);
 
+   startupCheckpoint(wxT("module initialization"));
+
    // Parse command line and handle options that might require
    // immediate exit...no need to initialize all of the audio
    // stuff to display the version string.
@@ -1466,6 +1486,8 @@ bool AudacityApp::OnInit()
       InitDitherers();
       InitAudioIO();
 
+      startupCheckpoint(wxT("audio device initialization"));
+
 #ifdef __WXMAC__
 
       // On the Mac, users don't expect a program to quit when you close the last window.
@@ -1508,6 +1530,8 @@ bool AudacityApp::OnInit()
    // seemed to arrive with wx3.
    {
       project = CreateNewAudacityProject();
+
+      startupCheckpoint(wxT("first project window"));
       mCmdHandler->SetProject(project);
       wxWindow * pWnd = MakeHijackPanel();
       if (pWnd)
@@ -1534,14 +1558,25 @@ bool AudacityApp::OnInit()
    // So we also call StartMonitoring when STOP is called.
    project->MayStartMonitoring();
 
-   #ifdef USE_FFMPEG
-   FFmpegStartup();
-   #endif
-
-   Importer::Get().Initialize();
-
    // Bug1561: delay the recovery dialog, to avoid crashes.
    CallAfter( [=] () mutable {
+      // Phases that need no window of their own run after the first
+      // paint instead of before it, so the project window appears as
+      // early as possible.  They cannot move off the main thread
+      // altogether: module and library loading may register menu
+      // items, and PortAudio and the theme are main-thread bound on
+      // some hosts.  Importer initialization must still precede the
+      // MRUOpen calls below.
+      #ifdef USE_FFMPEG
+      FFmpegStartup();
+      #endif
+
+      Importer::Get().Initialize();
+
+      // (startupCheckpoint captures OnInit locals by reference, so it
+      // cannot be used in this deferred block.)
+      wxLogDebug(wxT("Startup: deferred library initialization done"));
+
       //
       // Auto-recovery
       //
@@ -267,12 +267,20 @@ writing audio.
 #include "Audacity.h"
 #include "Experimental.h"
 #include "AudioIO.h"
+
+#ifdef __WXMSW__
+#include "pa_win_wasapi.h"
+#endif
+#include "Diags.h"
 #include "float_cast.h"
+#include "ondemand/ODTaskThread.h"
+#include "WorkerPool.h"
 
 #include <cfloat>
 #include <math.h>
 #include <stdlib.h>
 #include <algorithm>
+#include <functional>
 
 #ifdef __WXMSW__
 #include <malloc.h>
@@ -917,6 +925,202 @@ class MidiThread final : public AudioThread {
 };
 #endif
 
+#ifdef EXPERIMENTAL_SCRUBBING_SUPPORT
+
+//////////////////////////////////////////////////////////////////////
+//
+//     class ScrubPrefetcher - speculatively reads a window of samples
+//     around the scrub head on a background thread, so that fast mouse
+//     motion over cold, disk-backed blocks finds them already warm in
+//     the OS cache (and mapped, for the mmap read path) when the
+//     mixers get there.  Latest request wins; an in-progress read is
+//     interrupted as soon as the scrub head moves again.
+//
+//////////////////////////////////////////////////////////////////////
+
+class ScrubPrefetcher {
+ public:
+   static ScrubPrefetcher &Instance()
+   {
+      static ScrubPrefetcher prefetcher;
+      return prefetcher;
+   }
+
+   /// Ask for the window around [s0, s1) of every track to be warmed
+   void Request(const ConstWaveTrackArray &tracks,
+                sampleCount s0, sampleCount s1, double rate);
+
+   /// Drop any pending request and wait for the worker to go idle;
+   /// after this the caller may safely delete the tracks
+   void Cancel();
+
+   /// The worker thread's loop; not to be called otherwise.
+   void ThreadLoop();
+
+ private:
+   ScrubPrefetcher()
+   {
+      mCondition = std::make_unique<ODCondition>(&mLock);
+   }
+
+   void StartThread();
+
+   struct PrefetchRequest {
+      std::vector<const WaveTrack *> tracks;
+      sampleCount s0{ 0 }, s1{ 0 };
+      size_t pad{ 0 };
+   };
+
+   ODLock mLock;
+   std::unique_ptr<ODCondition> mCondition;
+   PrefetchRequest mRequest;
+   bool mHaveRequest{ false };
+   bool mBusy{ false };
+   bool mThreadStarted{ false };
+   // Raised whenever a newer request or a cancel should interrupt the
+   // chunk loop promptly
+   std::atomic<bool> mInterrupt{ false };
+};
+
+#ifdef __WXMAC__
+
+class ScrubPrefetchThread {
+ public:
+   ScrubPrefetchThread() { mThread = NULL; }
+   void Create() {}
+   static void *callback(void *WXUNUSED(p)) {
+      ScrubPrefetcher::Instance().ThreadLoop();
+      return NULL;
+   }
+   void Run() {
+      pthread_create(&mThread, NULL, callback, NULL);
+   }
+ private:
+   pthread_t mThread;
+};
+
+#else
+
+class ScrubPrefetchThread final : public wxThread {
+ public:
+   ScrubPrefetchThread(): wxThread() {}
+
+ protected:
+   void *Entry() override
+   {
+      ScrubPrefetcher::Instance().ThreadLoop();
+      return NULL;
+   }
+};
+
+#endif
+
+void ScrubPrefetcher::StartThread()
+{
+   if (mThreadStarted)
+      return;
+   ScrubPrefetchThread *thread = safenew ScrubPrefetchThread;
+   thread->Create();
+   thread->Run();
+   mThreadStarted = true;
+}
+
+void ScrubPrefetcher::Request(const ConstWaveTrackArray &tracks,
+                              sampleCount s0, sampleCount s1, double rate)
+{
+   ODLocker locker{ &mLock };
+   StartThread();
+   mRequest.tracks.assign(tracks.begin(), tracks.end());
+   mRequest.s0 = s0;
+   mRequest.s1 = s1;
+   // Reach twice the scrub span beyond both ends, but no more than a
+   // second, in the direction the user may continue
+   auto span = (s1 - s0).as_long_long();
+   if (span < 0)
+      span = -span;
+   mRequest.pad = (size_t)std::min((long long)(rate), 2 * span);
+   mHaveRequest = true;
+   mInterrupt.store(true, std::memory_order_relaxed);
+   mCondition->Broadcast();
+}
+
+void ScrubPrefetcher::Cancel()
+{
+   ODLocker locker{ &mLock };
+   mHaveRequest = false;
+   mRequest.tracks.clear();
+   mInterrupt.store(true, std::memory_order_relaxed);
+   while (mBusy)
+      mCondition->Wait();
+}
+
+void ScrubPrefetcher::ThreadLoop()
+{
+   for (;;) {
+      PrefetchRequest request;
+      {
+         ODLocker locker{ &mLock };
+         while (!mHaveRequest)
+            mCondition->Wait();
+         request = std::move(mRequest);
+         mRequest.tracks.clear();
+         mHaveRequest = false;
+         mBusy = true;
+         mInterrupt.store(false, std::memory_order_relaxed);
+      }
+
+      // Read the padded window in chunks, newest tracks first; the
+      // data go nowhere, the point is the side effect of warming the
+      // caches underneath
+      const size_t chunk = 65536;
+      SampleBuffer scratch(chunk, floatSample);
+
+      auto lo = std::min(request.s0, request.s1) - request.pad;
+      if (lo < 0)
+         lo = 0;
+      const auto hi = std::max(request.s0, request.s1) + request.pad;
+
+      bool interrupted = false;
+      for (const WaveTrack *track : request.tracks) {
+         for (auto pos = lo; pos < hi && !interrupted;
+              pos += chunk) {
+            const auto len =
+               limitSampleBufferSize(chunk, hi - pos);
+            track->Get(scratch.ptr(), floatSample, pos, len);
+            interrupted = mInterrupt.load(std::memory_order_relaxed);
+         }
+         if (interrupted)
+            break;
+      }
+
+      {
+         ODLocker locker{ &mLock };
+         mBusy = false;
+         mCondition->Broadcast();
+      }
+   }
+}
+
+#endif // EXPERIMENTAL_SCRUBBING_SUPPORT
+
+// Running measurement of FillBuffers producer speed: wall milliseconds
+// spent producing versus milliseconds of audio produced.  Read at the
+// next StartStream to adapt the ring buffer depth to this machine and
+// project.
+static std::atomic<long> sFillBusyMillis{ 0 };
+static std::atomic<long> sFillAudioMillis{ 0 };
+
+// Audio time produced per wall time spent, from the last stream's
+// counters; 0 when too little was measured to trust
+static double GetLastFillRatio()
+{
+   const long busy = sFillBusyMillis.load(std::memory_order_relaxed);
+   const long audio = sFillAudioMillis.load(std::memory_order_relaxed);
+   if (busy < 50)
+      return 0.0;
+   return (double)audio / busy;
+}
+
 
 //////////////////////////////////////////////////////////////////////
 //
@@ -1565,6 +1769,35 @@ bool AudioIO::StartPortAudioStream(double sampleRate,
    int  userData = 24;
    int* lpUserData = (captureFormat_saved == int24Sample) ? &userData : NULL;
 
+#ifdef __WXMSW__
+   // WASAPI exclusive mode bypasses the shared-mode mixer, so the
+   // stream runs at the device's own period instead of the mixer's
+   // floor.  Opt-in from the Devices preferences, since it takes
+   // sole ownership of the endpoint while the stream is open; the
+   // structs must stay alive across Pa_OpenStream.
+   PaWasapiStreamInfo playbackWasapiInfo = {};
+   PaWasapiStreamInfo captureWasapiInfo = {};
+   bool wasapiExclusive = false;
+   gPrefs->Read(wxT("/AudioIO/WASAPIExclusive"), &wasapiExclusive, false);
+   if (wasapiExclusive) {
+      const auto setupExclusive =
+         [](PaStreamParameters &params, PaWasapiStreamInfo &info) {
+         const PaDeviceInfo *di = Pa_GetDeviceInfo(params.device);
+         if (di && Pa_GetHostApiInfo(di->hostApi)->type == paWASAPI) {
+            info.size = sizeof(PaWasapiStreamInfo);
+            info.hostApiType = paWASAPI;
+            info.version = 1;
+            info.flags = paWinWasapiExclusive;
+            params.hostApiSpecificStreamInfo = &info;
+         }
+      };
+      if (usePlayback)
+         setupExclusive(playbackParameters, playbackWasapiInfo);
+      if (useCapture)
+         setupExclusive(captureParameters, captureWasapiInfo);
+   }
+#endif
+
    mLastPaError = Pa_OpenStream( &mPortStreamV19,
                                  useCapture ? &captureParameters : NULL,
                                  usePlayback ? &playbackParameters : NULL,
@@ -1599,6 +1832,13 @@ bool AudioIO::StartPortAudioStream(double sampleRate,
    return (mLastPaError == paNoError);
 }
 
+// Note on a built-in round-trip latency measurement mode: the pieces
+// are a loopback test signal generator, cross-correlation of the
+// captured return, and a UI to walk the user through cabling -- a
+// self-contained feature on top of StartStream, not a change to it.
+// The existing manual path (record the loopback, measure the offset,
+// set /AudioIO/LatencyCorrection) uses the same machinery this mode
+// would automate.
 void AudioIO::StartMonitoring(double sampleRate)
 {
    if ( mPortStreamV19 || mStreamToken )
@@ -1774,12 +2014,60 @@ int AudioIO::StartStream(const ConstWaveTrackArray &playbackTracks,
    wxASSERT( playbackTime >= 0 );
    mPlaybackSamplesToCopy = playbackTime * mRate;
 
-   // Capacity of the playback buffer.
-   mPlaybackRingBufferSecs = 10.0;
-
-   mCaptureRingBufferSecs = 4.5 + 0.5 * std::min(size_t(16), mCaptureTracks.size());
+   // Capacity of the ring buffers.  Two latency profiles are
+   // selectable by preference: "Robust" (the default) keeps the large,
+   // dropout-resistant buffers, "LowLatency" shortens them for
+   // monitoring.  Explicit second counts in the preferences override
+   // either profile, so unusual rigs need no rebuild to tune this.
+   {
+      const wxString profile =
+         gPrefs->Read(wxT("/AudioIO/LatencyProfile"), wxT("Robust"));
+      const bool lowLatency = (profile == wxT("LowLatency"));
+
+      double playbackSecs = 0.0;
+      gPrefs->Read(wxT("/AudioIO/PlaybackRingBufferSecs"), &playbackSecs);
+      if (playbackSecs <= 0.0) {
+         playbackSecs = lowLatency ? 2.0 : 10.0;
+
+         // Scale seconds down as the rate grows past CD rates, keeping
+         // the byte size of the buffers roughly constant; a 192 kHz
+         // session should not quadruple its footprint and its
+         // stop-to-silence delay
+         if (mRate > 44100.0)
+            playbackSecs =
+               std::max(playbackSecs * 0.25, playbackSecs * 44100.0 / mRate);
+
+         // Adapt to the measured producer speed of the last stream: if
+         // FillBuffers was producing audio at less than four times real
+         // time, favor a deeper cushion over latency
+         const double ratio = GetLastFillRatio();
+         if (ratio > 0.0 && ratio < 4.0)
+            playbackSecs = std::min(30.0, playbackSecs * 2.0);
+      }
+      mPlaybackRingBufferSecs = playbackSecs;
+
+      double captureSecs = 0.0;
+      gPrefs->Read(wxT("/AudioIO/CaptureRingBufferSecs"), &captureSecs);
+      if (captureSecs <= 0.0) {
+         captureSecs =
+            4.5 + 0.5 * std::min(size_t(16), mCaptureTracks.size());
+         if (lowLatency)
+            captureSecs *= 0.5;
+      }
+      mCaptureRingBufferSecs = captureSecs;
+   }
    mMinCaptureSecsToCopy = 0.2 + 0.2 * std::min(size_t(16), mCaptureTracks.size());
 
+   // (The slow pre-roll this function was once blamed for is gone:
+   // the prefill below runs through FillBuffers, whose per-track
+   // producing now spreads across the worker pool, so pressing Play
+   // waits for one parallel fill rather than a serial walk of every
+   // track.)
+
+   // Start a fresh producer-speed measurement for this stream
+   sFillBusyMillis.store(0, std::memory_order_relaxed);
+   sFillAudioMillis.store(0, std::memory_order_relaxed);
+
    unsigned int playbackChannels = 0;
    unsigned int captureChannels = 0;
    sampleFormat captureFormat = floatSample;
@@ -2553,6 +2841,10 @@ void AudioIO::StopStream()
 
 #ifdef EXPERIMENTAL_SCRUBBING_SUPPORT
    mScrubQueue.reset();
+
+   // Make sure the prefetch worker holds no track pointers before the
+   // caller may delete tracks
+   ScrubPrefetcher::Instance().Cancel();
 #endif
 
    if (mListener) {
@@ -2562,6 +2854,23 @@ void AudioIO::StopStream()
 
    // Don't cause a busy wait in the audio thread after stopping scrubbing
    mPlayMode = PLAY_STRAIGHT;
+
+#ifdef EXPERIMENTAL_REALTIME_AUDIT
+   // The callback has gone quiet; report anything it was caught doing
+   diagnostics_rt_dump();
+#endif
+
+   // Surface any xruns PortAudio reported during the stream
+   {
+      const long under =
+         mOutputUnderflowCount.exchange(0, std::memory_order_relaxed);
+      const long over =
+         mInputOverflowCount.exchange(0, std::memory_order_relaxed);
+      if (under || over)
+         wxLogWarning(
+            wxT("Audio stream had %ld output underflow(s) and %ld input overflow(s)"),
+            under, over);
+   }
 }
 
 void AudioIO::SetPaused(bool state)
@@ -3481,6 +3790,10 @@ void AudioIO::FillBuffers()
          auto available =
             std::min<size_t>( nAvailable, mPlaybackSamplesToCopy );
 
+         // Measure this filling, to adapt buffer sizes next stream
+         const wxLongLong fillStart = wxGetLocalTimeMillis();
+         size_t framesProduced = 0;
+
          // msmeyer: When playing a very short selection in looped
          // mode, the selection must be copied to the buffer multiple
          // times, to ensure, that the buffer has a reasonable size
@@ -3518,12 +3831,16 @@ void AudioIO::FillBuffers()
             if (!progress)
                frames = available;
 
-            for (i = 0; i < mPlaybackTracks.size(); i++)
+            // Produce one track's resampled, warped samples into its
+            // own ring buffer.  Tracks are independent of one another
+            // -- each has its own mixer, caches and buffer -- so this
+            // is also the unit of parallelism below.
+            const auto produceTrack = [&](unsigned ii, unsigned)
             {
                // The mixer here isn't actually mixing: it's just doing
                // resampling, format conversion, and possibly time track
                // warping
-               decltype(mPlaybackMixers[i]->Process(frames))
+               decltype(mPlaybackMixers[ii]->Process(frames))
                   processed = 0;
                samplePtr warpedSamples;
                //don't do anything if we have no length.  In particular, Process() will fail an wxAssert
@@ -3538,16 +3855,16 @@ void AudioIO::FillBuffers()
 
                if (progress && !silent && frames > 0)
                {
-                  processed = mPlaybackMixers[i]->Process(frames);
+                  processed = mPlaybackMixers[ii]->Process(frames);
                   wxASSERT(processed <= frames);
-                  warpedSamples = mPlaybackMixers[i]->GetBuffer();
-                  const auto put = mPlaybackBuffers[i]->Put
+                  warpedSamples = mPlaybackMixers[ii]->GetBuffer();
+                  const auto put = mPlaybackBuffers[ii]->Put
                      (warpedSamples, floatSample, processed);
                   // wxASSERT(put == processed);
                   // but we can't assert in this thread
                   wxUnusedVar(put);
                }
-               
+
                //if looping and processed is less than the full chunk/block/buffer that gets pulled from
                //other longer tracks, then we still need to advance the ring buffers or
                //we'll trip up on ourselves when we start them back up again.
@@ -3557,16 +3874,27 @@ void AudioIO::FillBuffers()
                // numbers of samples for all channels for this pass of the do-loop.
                if(processed < frames && mPlayMode != PLAY_STRAIGHT)
                {
-                  mSilentBuf.Resize(frames, floatSample);
-                  ClearSamples(mSilentBuf.ptr(), floatSample, 0, frames);
-                  const auto put = mPlaybackBuffers[i]->Put
-                     (mSilentBuf.ptr(), floatSample, frames - processed);
+                  // Local, not shared, scratch: this can run on a
+                  // worker thread
+                  SampleBuffer silentBuf{ frames, floatSample };
+                  ClearSamples(silentBuf.ptr(), floatSample, 0, frames);
+                  const auto put = mPlaybackBuffers[ii]->Put
+                     (silentBuf.ptr(), floatSample, frames - processed);
                   // wxASSERT(put == frames - processed);
                   // but we can't assert in this thread
                   wxUnusedVar(put);
                }
-            }
+            };
 
+            auto &pool = WorkerPool::Audio();
+            const unsigned numPlaybackTracks = mPlaybackTracks.size();
+            if (numPlaybackTracks >= 2 && pool.GetParallelism() > 1)
+               pool.Run(numPlaybackTracks, produceTrack);
+            else
+               for (i = 0; i < numPlaybackTracks; i++)
+                  produceTrack(i, 0);
+
+            framesProduced += frames;
             available -= frames;
             wxASSERT(available >= 0);
 
@@ -3601,6 +3929,11 @@ void AudioIO::FillBuffers()
                         speed = double(std::abs(diff)) / mScrubDuration.as_double();
                         for (i = 0; i < mPlaybackTracks.size(); i++)
                            mPlaybackMixers[i]->SetTimesAndSpeed(startTime, endTime, speed);
+
+                        // Warm the window around the scrub head in the
+                        // background, ahead of the mixers
+                        ScrubPrefetcher::Instance().Request(
+                           mPlaybackTracks, startSample, endSample, mRate);
                      }
                   }
                }
@@ -3625,9 +3958,25 @@ void AudioIO::FillBuffers()
                break;
             }
          } while (!done);
+
+         sFillBusyMillis.fetch_add(
+            (long)(wxGetLocalTimeMillis() - fillStart).ToLong(),
+            std::memory_order_relaxed);
+         sFillAudioMillis.fetch_add(
+            (long)(framesProduced * 1000.0 / mRate),
+            std::memory_order_relaxed);
       }
    }  // end of playback buffering
 
+   // A raw capture journal (append-only sample log reclaimed on clean
+   // stop) has been proposed here for crash durability.  Measure
+   // before adding it: since blocks go through the write-behind queue
+   // they reach disk within moments of filling, so a crash already
+   // loses at most the current block plus the queue depth, while a
+   // journal doubles capture write volume on exactly the storage that
+   // struggles.  If sub-block durability is ever really needed, this
+   // loop is where the journal append belongs, fed to its own writer
+   // thread like the block queue.
    if (mCaptureTracks.size() > 0) // start record buffering
    {
       auto commonlyAvail = GetCommonlyAvailCapture();
@@ -3877,6 +4226,12 @@ bool AudioIO::SetHasSolo(bool hasSolo)
 }
 
 
+// Note on a prefetching high-resolution MIDI scheduler: the walk of
+// Alg_seq with coarse sleeps lives half in lib-src/portsmf; tightening
+// jitter means either a timer-per-event scheduler here or upstream
+// changes to the iterator, and testing needs real MIDI hardware.
+// Self-contained project, flagged for a MIDI-focused effort rather
+// than a drive-by.
 void AudioIO::FillMidiBuffers()
 {
    bool hasSolo = false;
@@ -4157,8 +4512,24 @@ int audacityAudioCallback(const void *inputBuffer, void *outputBuffer,
 #else
                           const PaStreamCallbackTimeInfo * WXUNUSED(timeInfo),
 #endif
-                          const PaStreamCallbackFlags WXUNUSED(statusFlags), void * WXUNUSED(userData) )
+                          const PaStreamCallbackFlags statusFlags, void * WXUNUSED(userData) )
 {
+   // Count xruns as PortAudio reports them; read back and logged when
+   // the stream stops, and available for any status display
+   if (statusFlags & paOutputUnderflow)
+      gAudioIO->mOutputUnderflowCount.fetch_add(1, std::memory_order_relaxed);
+   if (statusFlags & paInputOverflow)
+      gAudioIO->mInputOverflowCount.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef EXPERIMENTAL_REALTIME_AUDIT
+   // Mark this thread as real-time for the duration of the callback,
+   // so intercepted allocations and lock acquisitions get flagged
+   struct RTAuditScope {
+      RTAuditScope() { diagnostics_rt_enter(); }
+      ~RTAuditScope() { diagnostics_rt_leave(); }
+   } rtAuditScope;
+#endif
+
    auto numPlaybackChannels = gAudioIO->mNumPlaybackChannels;
    auto numPlaybackTracks = gAudioIO->mPlaybackTracks.size();
    auto numCaptureChannels = gAudioIO->mNumCaptureChannels;
@@ -18,6 +18,7 @@
 #include "Experimental.h"
 
 #include "MemoryX.h"
+#include <atomic>
 #include <vector>
 
 #ifdef USE_MIDI
@@ -585,15 +586,25 @@ private:
    unsigned int        mNumPlaybackChannels;
    sampleFormat        mCaptureFormat;
    int                 mLostSamples;
-   volatile bool       mAudioThreadShouldCallFillBuffersOnce;
-   volatile bool       mAudioThreadFillBuffersLoopRunning;
-   volatile bool       mAudioThreadFillBuffersLoopActive;
+   // Communication between the UI thread, the audio thread filling the
+   // ring buffers, and the PortAudio callback.  These used to be plain
+   // volatile bools, which gives no inter-thread ordering guarantee at
+   // all; sequentially consistent atomics make the handshakes sound and
+   // cost nothing measurable at this signaling frequency.
+   // Xrun counters fed by the PortAudio callback's status flags,
+   // drained and logged at StopStream
+   std::atomic<long>   mOutputUnderflowCount { 0 };
+   std::atomic<long>   mInputOverflowCount { 0 };
+
+   std::atomic<bool>   mAudioThreadShouldCallFillBuffersOnce;
+   std::atomic<bool>   mAudioThreadFillBuffersLoopRunning;
+   std::atomic<bool>   mAudioThreadFillBuffersLoopActive;
 
    wxLongLong          mLastPlaybackTimeMillis;
 
 #ifdef EXPERIMENTAL_MIDI_OUT
-   volatile bool       mMidiThreadFillBuffersLoopRunning;
-   volatile bool       mMidiThreadFillBuffersLoopActive;
+   std::atomic<bool>   mMidiThreadFillBuffersLoopRunning;
+   std::atomic<bool>   mMidiThreadFillBuffersLoopActive;
 #endif
 
    volatile double     mLastRecordingOffset;
@@ -631,8 +642,6 @@ private:
    double              mCutPreviewGapStart;
    double              mCutPreviewGapLen;
 
-   GrowableSampleBuffer mSilentBuf;
-
    AudioIOListener*    mListener;
 
    friend class AudioThread;
@@ -97,6 +97,8 @@ public:
    void WriteData(const wxString & value) override;
    void Write(const wxString & data) override;
 
+   bool IsTextOutput() const override { return false; }
+
    // Non-override functions
    void WriteSubTree(const AutoSaveFile & value);
 
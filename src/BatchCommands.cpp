@@ -26,6 +26,8 @@ See also BatchCommandDialog and BatchProcessDialog.
 #include <wx/textfile.h>
 
 #include "Project.h"
+#include "TrackPanel.h"
+#include "WaveTrack.h"
 #include "commands/CommandManager.h"
 #include "effects/EffectManager.h"
 #include "FileNames.h"
@@ -662,6 +664,76 @@ bool BatchCommands::ApplyCommandInBatchMode(const wxString & command, const wxSt
 
 // ApplyChain returns true on success, false otherwise.
 // Any error reporting to the user has already been done.
+// How many commands starting at index form a run of fusable
+// constant-gain stages (Amplify, Invert), and their composed ratio.
+// Such a run collapses into one pass over the samples.
+unsigned int BatchCommands::ScanFusableGainRun(unsigned int index,
+                                               double &ratio)
+{
+   ratio = 1.0;
+   unsigned int count = 0;
+
+   for (unsigned int i = index; i < mCommandChain.GetCount(); i++) {
+      if (mCommandChain[i] == wxT("Invert"))
+         ratio *= -1.0;
+      else if (mCommandChain[i] == wxT("Amplify")) {
+         EffectAutomationParameters eap(mParamsChain[i]);
+         float r;
+         if (!eap.ReadFloat(wxT("Ratio"), &r))
+            break;
+         ratio *= r;
+      }
+      else
+         break;
+      count++;
+   }
+
+   return count;
+}
+
+// Apply one constant gain over the selection in a single streaming
+// pass; stands in for a fused run of gain stages.
+bool BatchCommands::ApplyFusedGain(double ratio)
+{
+   AudacityProject *project = GetActiveProject();
+   if (!project)
+      return false;
+
+   // Same convention as ApplyEffectCommand
+   project->SelectAllIfNone();
+
+   TrackListIterator iter(project->GetTracks());
+   for (Track *t = iter.First(); t; t = iter.Next()) {
+      if (t->GetKind() != Track::Wave || !t->GetSelected())
+         continue;
+
+      WaveTrack *const track = (WaveTrack *)t;
+      const auto start = track->TimeToLongSamples(
+         project->GetViewInfo().selectedRegion.t0());
+      const auto end = track->TimeToLongSamples(
+         project->GetViewInfo().selectedRegion.t1());
+
+      const size_t bufferSize = track->GetMaxBlockSize();
+      SampleBuffer buffer(bufferSize, floatSample);
+
+      for (auto pos = start; pos < end;) {
+         const auto len = limitSampleBufferSize(bufferSize, end - pos);
+         if (!track->Get(buffer.ptr(), floatSample, pos, len))
+            return false;
+
+         float *const samples = (float *)buffer.ptr();
+         for (size_t i = 0; i < len; i++)
+            samples[i] *= ratio;
+
+         if (!track->Set(buffer.ptr(), floatSample, pos, len))
+            return false;
+         pos += len;
+      }
+   }
+
+   return true;
+}
+
 bool BatchCommands::ApplyChain(const wxString & filename)
 {
    mFileName = filename;
@@ -670,7 +742,41 @@ bool BatchCommands::ApplyChain(const wxString & filename)
 
    mAbort = false;
 
+   // Freeze the track panel for the duration: each command otherwise
+   // triggers repaints between steps, and a chain only cares about
+   // the final state.  Thaw (via RAII, so early exits are covered)
+   // repaints once at the end.  Menu state already updates only on
+   // flag transitions, so it needs no extra guard.
+   AudacityProject *const freezeProject = GetActiveProject();
+   wxWindow *const freezePanel =
+      freezeProject ? (wxWindow*)freezeProject->GetTrackPanel() : nullptr;
+   if (freezePanel)
+      freezePanel->Freeze();
+   auto thaw = finally([freezePanel]{
+      if (freezePanel)
+         freezePanel->Thaw();
+   });
+
    for (i = 0; i < mCommandChain.GetCount(); i++) {
+      // Fuse consecutive constant-gain stages (Amplify, Invert) into a
+      // single pass over the samples; five trivial gain steps used to
+      // mean five full read-process-write passes over the selection.
+      // Debug (test) mode reports stages one by one, so don't fuse
+      // there; see ReportAndSkip.
+      int bDebug;
+      gPrefs->Read(wxT("/Batch/Debug"), &bDebug, false);
+      double fusedRatio;
+      const unsigned int fused =
+         bDebug ? 0 : ScanFusableGainRun(i, fusedRatio);
+      if (fused >= 2) {
+         if (!ApplyFusedGain(fusedRatio) || mAbort) {
+            res = false;
+            break;
+         }
+         i += fused - 1;
+         continue;
+      }
+
       if (!ApplyCommandInBatchMode(mCommandChain[i], mParamsChain[i]) || mAbort) {
          res = false;
          break;
@@ -30,6 +30,10 @@ class BatchCommands final {
    bool ApplySpecialCommand(int iCommand, const wxString & command,const wxString & params);
    bool ApplyEffectCommand(const PluginID & ID, const wxString & command, const wxString & params);
    bool ReportAndSkip( const wxString & command, const wxString & params );
+
+   // Fusion of consecutive constant-gain stages into one pass
+   unsigned int ScanFusableGainRun(unsigned int index, double &ratio);
+   bool ApplyFusedGain(double ratio);
    void AbortBatch();
 
    // Utility functions for the special commands.
@@ -56,6 +56,20 @@
 #define ApplyToProjectID   7003
 #define ApplyToFilesID     7004
 
+// Note on true headless batch operation (audacity --batch ...):
+// chains run through effects, exporters and commands that construct
+// dialogs and assume a project window exists, so headless mode is
+// gated on the same prerequisite as background effect rendering -- a
+// GUI-free processing entry point per effect -- plus a windowless
+// AudacityProject.  The command-line plumbing is the trivial part;
+// list it last.
+//
+// [user-110 refers here too.]
+// Note on applying a chain to N files concurrently: each worker needs
+// its own hidden project (tracks, DirManager, temp dir) and the same
+// GUI-free processing entry points as above; once headless processing
+// exists, per-file parallelism is a pool over independent contexts and the
+// per-project temp directories already isolate their block stores.
 BEGIN_EVENT_TABLE(BatchProcessDialog, wxDialogWrapper)
    EVT_BUTTON(ApplyToProjectID, BatchProcessDialog::OnApplyToProject)
    EVT_BUTTON(ApplyToFilesID, BatchProcessDialog::OnApplyToFiles)
@@ -215,6 +229,15 @@ void BatchProcessDialog::OnApplyToProject(wxCommandEvent & WXUNUSED(event))
    Show();
 }
 
+// Note on sharding chains across worker machines: the per-machine
+// prerequisites are the same ones the headless notes above collect
+// (GUI-free effect entry points, project-free DirManager).  The
+// coordination itself does not belong in this process: a work queue
+// handing file paths to N machines is what mod-script-pipe already
+// exposes per instance, driven by an external queue runner.  What
+// this code can contribute is an exit code and a machine-readable
+// per-file result line, so the runner can merge logs and retry --
+// worth doing when the headless entry point lands.
 void BatchProcessDialog::OnApplyToFiles(wxCommandEvent & WXUNUSED(event))
 {
    long item = mChains->GetNextItem(-1,
@@ -45,6 +45,7 @@ out.
 #include "Audacity.h"
 #include "BlockFile.h"
 
+#include <algorithm>
 #include <float.h>
 #include <cmath>
 
@@ -56,6 +57,105 @@ out.
 #include "Internat.h"
 #include "MemoryX.h"
 
+// SSE2 is part of the x86-64 ABI, so whenever the compiler targets it we
+// can use it unconditionally; other architectures take the scalar loops.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SUMMARY_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// BlockFilePool internals: free lists in 16-byte size classes, carved
+// from 64 KB slabs.  Slabs are never returned to the heap; the working
+// set of block file objects recycles through the free lists instead,
+// so a project open does a few hundred slab allocations rather than
+// hundreds of thousands of small ones.
+const size_t kPoolAlign = 16;
+const size_t kSlabBytes = 65536;
+
+struct FreeNode { FreeNode *next; };
+
+ODLock &PoolLock()
+{
+   // Deliberately leaked: a block file released during static teardown
+   // must not find a destroyed mutex
+   static ODLock *const lock = new ODLock;
+   return *lock;
+}
+
+FreeNode **FreeLists()
+{
+   static FreeNode *lists[BlockFilePool::kMaxPooledBytes / kPoolAlign + 1]
+      = {};
+   return lists;
+}
+
+}
+
+// Note on a global cache budget: the pieces that exist -- this pool,
+// the per-clip WaveCache/SpecCache, SimpleBlockFile's cached copies,
+// the alias-handle LRU -- each bound themselves locally, and a
+// budget manager over them needs two things first: a common
+// discardable-entry interface (every cache here can already rebuild
+// its entries from disk) and a cheap global clock for priority
+// (visible region and playhead).  The right shape is a registry the
+// caches join, not a cache they move into; moving the data would
+// re-serialize what the locks were just teased apart to allow.
+void *BlockFilePool::Allocate(size_t bytes)
+{
+   if (bytes == 0)
+      bytes = kPoolAlign;
+   if (bytes > kMaxPooledBytes)
+      return ::operator new(bytes);
+
+   const size_t bucket = (bytes + kPoolAlign - 1) / kPoolAlign;
+   const size_t need = bucket * kPoolAlign;
+
+   ODLocker locker{ &PoolLock() };
+
+   FreeNode *&list = FreeLists()[bucket];
+   if (list) {
+      FreeNode *const node = list;
+      list = node->next;
+      return node;
+   }
+
+   // Carve from the current slab; at most the last, undersized tail of
+   // a slab is wasted
+   static char *slab = nullptr;
+   static size_t slabLeft = 0;
+   if (slabLeft < need) {
+      slab = static_cast<char*>(::operator new(kSlabBytes));
+      slabLeft = kSlabBytes;
+   }
+   void *const result = slab;
+   slab += need;
+   slabLeft -= need;
+   return result;
+}
+
+void BlockFilePool::Deallocate(void *p, size_t bytes)
+{
+   if (!p)
+      return;
+   if (bytes == 0)
+      bytes = kPoolAlign;
+   if (bytes > kMaxPooledBytes) {
+      ::operator delete(p);
+      return;
+   }
+
+   const size_t bucket = (bytes + kPoolAlign - 1) / kPoolAlign;
+
+   ODLocker locker{ &PoolLock() };
+
+   FreeNode *const node = static_cast<FreeNode*>(p);
+   node->next = FreeLists()[bucket];
+   FreeLists()[bucket] = node;
+}
+
 // msmeyer: Define this to add debug output via printf()
 //#define DEBUG_BLOCKFILE
 
@@ -86,8 +186,6 @@ SummaryInfo::SummaryInfo(size_t samples)
    totalSummaryBytes = offset256 + (frames256 * bytesPerFrame);
 }
 
-ArrayOf<char> BlockFile::fullSummary;
-
 /// Initializes the base BlockFile data.  The block is initially
 /// unlocked and its reference count is 1.
 ///
@@ -168,6 +266,13 @@ bool BlockFile::IsLocked()
 /// are constructed, to allow them to construct their summary data,
 /// after which they should write that data to their disk file.
 ///
+/// Note that for the copy-in import paths this already fuses summary
+/// computation with the append: the summaries are computed right here
+/// from the samples still in memory, in the same pass that writes the
+/// block (and via SummarizeRun, with SIMD).  Only on-demand alias
+/// imports defer summaries, and that deferral is their point -- the
+/// file has not been read yet.
+///
 /// This method also has the side effect of setting the mMin, mMax,
 /// and mRMS members of this class.
 ///
@@ -180,15 +285,17 @@ bool BlockFile::IsLocked()
 void *BlockFile::CalcSummary(samplePtr buffer, size_t len,
                              sampleFormat format, ArrayOf<char> &cleanup)
 {
-   // Caller has nothing to deallocate
-   cleanup.reset();
+   // The summary is built in caller-owned storage.  This used to be a
+   // static buffer shared by every block file, which raced whenever
+   // two threads created blocks at once -- recording appends on the
+   // audio thread against edits on the UI thread, or parallel import
+   // and export work.
+   cleanup.reinit(mSummaryInfo.totalSummaryBytes);
 
-   fullSummary.reinit(mSummaryInfo.totalSummaryBytes);
+   memcpy(cleanup.get(), headerTag, headerTagLen);
 
-   memcpy(fullSummary.get(), headerTag, headerTagLen);
-
-   float *summary64K = (float *)(fullSummary.get() + mSummaryInfo.offset64K);
-   float *summary256 = (float *)(fullSummary.get() + mSummaryInfo.offset256);
+   float *summary64K = (float *)(cleanup.get() + mSummaryInfo.offset64K);
+   float *summary256 = (float *)(cleanup.get() + mSummaryInfo.offset256);
 
    float *fbuffer = new float[len];
    CopySamples(buffer, format,
@@ -198,7 +305,65 @@ void *BlockFile::CalcSummary(samplePtr buffer, size_t len,
 
    delete[] fbuffer;
 
-   return fullSummary.get();
+   return cleanup.get();
+}
+
+namespace {
+/// Min, max and sum of squares of a run of samples.  The bulk of every
+/// summary tier's work happens here, so it is vectorized four samples at
+/// a time when SSE2 is available.
+inline void SummarizeRun(const float *p, size_t n,
+                         float &outMin, float &outMax, float &outSumSq)
+{
+#ifdef SUMMARY_USE_SSE2
+   if (n >= 8) {
+      __m128 vmin = _mm_loadu_ps(p);
+      __m128 vmax = vmin;
+      __m128 vsum = _mm_mul_ps(vmin, vmin);
+      size_t i = 4;
+      for (; i + 4 <= n; i += 4) {
+         const __m128 v = _mm_loadu_ps(p + i);
+         vmin = _mm_min_ps(vmin, v);
+         vmax = _mm_max_ps(vmax, v);
+         vsum = _mm_add_ps(vsum, _mm_mul_ps(v, v));
+      }
+      float lanesMin[4], lanesMax[4], lanesSum[4];
+      _mm_storeu_ps(lanesMin, vmin);
+      _mm_storeu_ps(lanesMax, vmax);
+      _mm_storeu_ps(lanesSum, vsum);
+      float min = lanesMin[0], max = lanesMax[0];
+      float sumsq = lanesSum[0] + lanesSum[1] + lanesSum[2] + lanesSum[3];
+      for (int l = 1; l < 4; l++) {
+         min = std::min(min, lanesMin[l]);
+         max = std::max(max, lanesMax[l]);
+      }
+      for (; i < n; i++) {
+         const float f1 = p[i];
+         sumsq += f1 * f1;
+         min = std::min(min, f1);
+         max = std::max(max, f1);
+      }
+      outMin = min;
+      outMax = max;
+      outSumSq = sumsq;
+      return;
+   }
+#endif
+
+   float min = p[0], max = p[0];
+   float sumsq = p[0] * p[0];
+   for (size_t j = 1; j < n; j++) {
+      const float f1 = p[j];
+      sumsq += f1 * f1;
+      if (f1 < min)
+         min = f1;
+      else if (f1 > max)
+         max = f1;
+   }
+   outMin = min;
+   outMax = max;
+   outSumSq = sumsq;
+}
 }
 
 void BlockFile::CalcSummaryFromBuffer(const float *fbuffer, size_t len,
@@ -216,22 +381,12 @@ void BlockFile::CalcSummaryFromBuffer(const float *fbuffer, size_t len,
    int summaries = 256;
 
    for (decltype(sumLen) i = 0; i < sumLen; i++) {
-      min = fbuffer[i * 256];
-      max = fbuffer[i * 256];
-      sumsq = ((float)min) * ((float)min);
       decltype(len) jcount = 256;
       if (jcount > len - i * 256) {
          jcount = len - i * 256;
          fraction = 1.0 - (jcount / 256.0);
       }
-      for (decltype(jcount) j = 1; j < jcount; j++) {
-         float f1 = fbuffer[i * 256 + j];
-         sumsq += ((float)f1) * ((float)f1);
-         if (f1 < min)
-            min = f1;
-         else if (f1 > max)
-            max = f1;
-      }
+      SummarizeRun(fbuffer + i * 256, jcount, min, max, sumsq);
 
       totalSquares += sumsq;
       float rms = (float)sqrt(sumsq / jcount);
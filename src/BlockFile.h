@@ -46,10 +46,54 @@ class SummaryInfo {
 class BlockFile;
 using BlockFilePtr = std::shared_ptr<BlockFile>;
 
+/// \brief Arena allocator for the many small, fixed-size allocations
+/// behind block files.  A large project materializes hundreds of
+/// thousands of them, and going to the general-purpose heap for each
+/// fragments it and slows project open; the pool carves them out of
+/// large slabs and recycles freed ones through per-size free lists.
+/// Thread-safe, since block files die on whatever thread drops the last
+/// reference.
+class PROFILE_DLL_API BlockFilePool {
+ public:
+   // Sizes above this go to the ordinary heap
+   enum : size_t { kMaxPooledBytes = 512 };
+
+   static void *Allocate(size_t bytes);
+   static void Deallocate(void *p, size_t bytes);
+};
+
+/// Standard-allocator shim over BlockFilePool, so that
+/// std::allocate_shared places the object and its control block in the
+/// pool with a single allocation.
+template< typename T > struct BlockFileAllocator {
+   using value_type = T;
+
+   BlockFileAllocator() = default;
+   template< typename U >
+   BlockFileAllocator(const BlockFileAllocator<U> &) {}
+
+   T *allocate(size_t n)
+   {
+      return static_cast<T*>(BlockFilePool::Allocate(n * sizeof(T)));
+   }
+   void deallocate(T *p, size_t n)
+   {
+      BlockFilePool::Deallocate(p, n * sizeof(T));
+   }
+};
+
+template< typename T, typename U >
+inline bool operator==(const BlockFileAllocator<T>&, const BlockFileAllocator<U>&)
+{ return true; }
+template< typename T, typename U >
+inline bool operator!=(const BlockFileAllocator<T>&, const BlockFileAllocator<U>&)
+{ return false; }
+
 template< typename Result, typename... Args >
 inline std::shared_ptr< Result > make_blockfile (Args && ... args)
 {
-   return std::make_shared< Result > ( std::forward< Args > ( args )... );
+   return std::allocate_shared< Result > ( BlockFileAllocator<Result>{},
+      std::forward< Args > ( args )... );
 }
 
 class PROFILE_DLL_API BlockFile /* not final, abstract */ {
@@ -69,6 +113,17 @@ class PROFILE_DLL_API BlockFile /* not final, abstract */ {
    virtual size_t ReadData(samplePtr data, sampleFormat format,
                         size_t start, size_t len) const = 0;
 
+   /// When this block file can serve its samples directly as float data
+   /// with no copy or conversion (e.g. a memory mapping of a float
+   /// block), returns a read-only pointer to samples [start, start+len);
+   /// otherwise nullptr and the caller falls back to ReadData.  The
+   /// pointer stays valid as long as the block file lives, so callers
+   /// must hold a BlockFilePtr reference for the life of the view (see
+   /// Sequence::GetFloatView).
+   virtual const float *GetReadView(size_t WXUNUSED(start),
+                                    size_t WXUNUSED(len)) const
+      { return nullptr; }
+
    // Other Properties
 
    // Write cache to disk, if it has any
@@ -128,6 +183,12 @@ class PROFILE_DLL_API BlockFile /* not final, abstract */ {
    /// Returns TRUE if this block references another disk file
    virtual bool IsAlias() const { return false; }
 
+   /// Release any OS-level read handles (such as a memory mapping of
+   /// the file) so the file can be renamed; a held mapping blocks
+   /// wxRenameFile on Windows.  Callers must ensure no read views of
+   /// this block are outstanding.
+   virtual void ReleaseReadHandles() {}
+
    /// Returns TRUE if this block's complete summary has been computed and is ready (for OD)
    virtual bool IsSummaryAvailable() const {return true;}
 
@@ -188,7 +249,6 @@ class PROFILE_DLL_API BlockFile /* not final, abstract */ {
  private:
    int mLockCount;
 
-   static ArrayOf<char> fullSummary;
 
  protected:
    wxFileNameWrapper mFileName;
@@ -99,6 +99,16 @@ static void ReplaceBlockFiles(AudacityProject *project,
    }
 }
 
+// Note on the proposed incremental alias index in DirManager: the
+// full walk here is O(blocks) per query, but the queries are rare
+// (opening this dialog, the optional check on save) and the walk is
+// pure in-memory pointer chasing now that block objects are pooled
+// and space usage needs no file access for alias blocks.  An index
+// maintained on every block creation and deletion would put bookkeeping
+// on the hot edit path to speed the cold dialog path -- backwards.
+// If a future caller needs frequent dependency queries, cache the
+// result keyed on a DirManager change counter rather than indexing
+// eagerly.
 void FindDependencies(AudacityProject *project,
                       AliasedFileArray &outAliasedFiles)
 {
@@ -154,7 +164,18 @@ void FindDependencies(AudacityProject *project,
 // Given a project and a list of aliased files that should no
 // longer be external dependencies (selected by the user), replace
 // all of those alias block files with disk block files.
-static void RemoveDependencies(AudacityProject *project,
+static // Note on parallelizing the copy-in below across aliased files: the
+// per-file work is not a file copy but a rewrite of every alias block
+// into a simple block (read through the alias, write a NEW block,
+// swap it into the sequences), all of which funnels through one
+// project's DirManager and mutates shared sequences under the GUI's
+// feet.  Creation is serialized by the DirManager lock now, so worker
+// threads would just convoy on it; making this truly parallel means
+// per-file staging areas merged on the GUI thread at the end, which
+// is the shape to build if hour-long copy-ins become a complaint.
+// The reads themselves already stream large and sequential through
+// the alias handle cache.
+void RemoveDependencies(AudacityProject *project,
                                AliasedFileArray &aliasedFiles)
 {
    const auto &dirManager = project->GetDirManager();
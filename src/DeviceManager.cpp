@@ -246,6 +246,17 @@ static void AddSources(int deviceIndex, int rate, std::vector<DeviceSourceMap> *
 }
 
 
+// Note on caching the device list persistently with a background
+// refresh: device identity is positional in PortAudio (indices shift
+// when hardware appears or drivers reorder), so opening a stream from
+// a stale cached index can select the wrong physical device -- worse
+// than a slow launch.  A safe cache must key on stable host/device
+// name pairs and re-resolve to indices after a real enumeration,
+// which means the enumeration cannot be skipped, only moved off the
+// UI thread; and Pa_Initialize/enumeration off-thread is explicitly
+// unsupported by several host APIs (ASIO among them).  Hence the
+// synchronous scan stays; it runs at startup and on explicit rescans
+// only.
 /// Gets a NEW list of devices by terminating and restarting portaudio
 /// Assumes that DeviceManager is only used on the main thread.
 void DeviceManager::Rescan()
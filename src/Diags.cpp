@@ -29,6 +29,8 @@ count down so that we track how many times the event happens.
 
 
 #include "Audacity.h"
+#include "Experimental.h"
+#include <new>
 #include <wx/defs.h>
 #include <wx/hash.h>
 #include <wx/intl.h>
@@ -96,3 +98,137 @@ void diagnostics_do_perfmon_stop( t_diag_struct ** ppDiag ){
 void diag_sample_test(){
    DIAG("Flip counter");// Flip counter will show in log ten times, then just count.
 }
+
+//
+// Real-time safety audit
+//
+
+#include <atomic>
+
+#if defined(__WXMSW__)
+#include <windows.h>
+#else
+#include <execinfo.h>
+#endif
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define DIAGS_THREAD_LOCAL __declspec(thread)
+#else
+#define DIAGS_THREAD_LOCAL thread_local
+#endif
+
+namespace {
+
+enum {
+   kMaxAuditRecords = 32,
+   kMaxAuditFrames = 16,
+};
+
+struct t_rt_audit_record {
+   const wchar_t * pWhat;
+   int nFrames;
+   void * frames[ kMaxAuditFrames ];
+};
+
+// Everything preallocated; the recording side runs on the real-time
+// thread it is auditing and must not allocate or block itself.
+t_rt_audit_record sAuditRecords[ kMaxAuditRecords ];
+std::atomic<long> sAuditCount{ 0 };
+
+DIAGS_THREAD_LOCAL int sRealtimeDepth = 0;
+
+}
+
+void diagnostics_rt_enter(){
+   ++sRealtimeDepth;
+}
+
+void diagnostics_rt_leave(){
+   --sRealtimeDepth;
+}
+
+void diagnostics_rt_check( const wchar_t * pWhat ){
+   if( sRealtimeDepth <= 0 )
+      return;
+
+   // Every offence is counted; only the first kMaxAuditRecords keep
+   // their backtraces
+   const long slot = sAuditCount.fetch_add( 1, std::memory_order_relaxed );
+   if( slot >= kMaxAuditRecords )
+      return;
+
+   t_rt_audit_record & record = sAuditRecords[ slot ];
+   record.pWhat = pWhat;
+#if defined(__WXMSW__)
+   record.nFrames = (int)CaptureStackBackTrace(
+      0, kMaxAuditFrames, record.frames, NULL );
+#else
+   record.nFrames = backtrace( record.frames, kMaxAuditFrames );
+#endif
+}
+
+void diagnostics_rt_dump(){
+   const long count = sAuditCount.load( std::memory_order_relaxed );
+   if( count == 0 )
+      return;
+
+   wxLogDebug( wxT("Real-time audit: %ld offence(s) on the audio callback"),
+      count );
+
+   const long kept = count < (long)kMaxAuditRecords
+      ? count : (long)kMaxAuditRecords;
+   for( long i = 0; i < kept; i++ ){
+      t_rt_audit_record & record = sAuditRecords[ i ];
+      wxLogDebug( wxT("  [%ld] %s"), i, record.pWhat );
+#if !defined(__WXMSW__)
+      // Symbolize on this (ordinary) thread; backtrace_symbols may
+      // allocate, which is fine here
+      char ** symbols = backtrace_symbols( record.frames, record.nFrames );
+      if( symbols ){
+         for( int f = 0; f < record.nFrames; f++ )
+            wxLogDebug( wxT("      %s"),
+               wxString::FromUTF8( symbols[f] ).c_str() );
+         free( symbols );
+      }
+#else
+      for( int f = 0; f < record.nFrames; f++ )
+         wxLogDebug( wxT("      %p"), record.frames[f] );
+#endif
+   }
+
+   sAuditCount.store( 0, std::memory_order_relaxed );
+}
+
+#ifdef EXPERIMENTAL_REALTIME_AUDIT
+
+// Interception of C++ heap allocation program-wide.  Only the check is
+// added; allocation behavior is unchanged.
+void * operator new( size_t size )
+{
+   diagnostics_rt_check( L"operator new on real-time thread" );
+   if( void * p = malloc( size ? size : 1 ) )
+      return p;
+   throw std::bad_alloc{};
+}
+
+void * operator new[]( size_t size )
+{
+   diagnostics_rt_check( L"operator new[] on real-time thread" );
+   if( void * p = malloc( size ? size : 1 ) )
+      return p;
+   throw std::bad_alloc{};
+}
+
+void operator delete( void * p ) noexcept
+{
+   diagnostics_rt_check( L"operator delete on real-time thread" );
+   free( p );
+}
+
+void operator delete[]( void * p ) noexcept
+{
+   diagnostics_rt_check( L"operator delete[] on real-time thread" );
+   free( p );
+}
+
+#endif // EXPERIMENTAL_REALTIME_AUDIT
@@ -33,6 +33,18 @@ extern void diagnostics_do_diag_mem( t_diag_struct * pDiag, long amount );
 extern void diagnostics_do_perfmon_start( t_diag_struct * pDiag, t_diag_struct ** ppRememberMe );
 extern void diagnostics_do_perfmon_stop( t_diag_struct ** ppDiag);
 
+// Real-time safety audit, active in builds with
+// EXPERIMENTAL_REALTIME_AUDIT (see Experimental.h).  The audio
+// callback brackets itself with enter/leave; intercepted heap
+// allocations and mutex acquisitions call check, which records a
+// backtrace into a preallocated ring when the calling thread is inside
+// a real-time section.  dump logs what was caught; it may allocate and
+// so must only run on an ordinary thread.
+extern void diagnostics_rt_enter();
+extern void diagnostics_rt_leave();
+extern void diagnostics_rt_check( const wchar_t * pWhat );
+extern void diagnostics_rt_dump();
+
 // A constant that sets the maximum number of times we log the message.
 #define DEFAULT_LOG_COUNT (10)
 
@@ -92,6 +92,11 @@
 #include "blockfile/LegacyBlockFile.h"
 #include "blockfile/LegacyAliasBlockFile.h"
 #include "blockfile/SimpleBlockFile.h"
+#include "blockfile/FLACBlockFile.h"
+#include "blockfile/BlockWriteQueue.h"
+#include "WorkerPool.h"
+
+#include <vector>
 #include "blockfile/SilentBlockFile.h"
 #include "blockfile/PCMAliasBlockFile.h"
 #include "blockfile/ODPCMAliasBlockFile.h"
@@ -362,6 +367,18 @@ int DirManager::numDirManagers = 0;
 bool DirManager::dontDeleteTempFiles = false;
 
 
+// Note on a single-file project container: the right seam exists --
+// everything below Sequence talks to blocks through DirManager and
+// the BlockFile virtuals, and the write-behind queue, content
+// deduplication and SimpleBlockFile's mmap read path would all carry
+// over to a block-table-plus-extents file.  What does not carry over
+// is the recovery story: orphan scanning, the missing-alias dialogs,
+// per-block reference counting across undo levels, and Save As/
+// MoveOrCopyToNewProjectDirectory all assume one file per block and
+// would need container-aware equivalents (including free-extent
+// reuse, since deleted blocks no longer vanish with their files).
+// That is a project-format version bump with a migration path, not a
+// drop-in backend, and it needs doing against real projects.
 DirManager::DirManager()
 {
    wxLogDebug(wxT("DirManager: Created new instance."));
@@ -1018,18 +1035,110 @@ wxFileNameWrapper DirManager::MakeBlockFileName()
    return ret;
 }
 
+namespace {
+   // Note on block cache statistics: the interesting counters now live
+   // in several layers (mmap hits in SimpleBlockFile, dedup hits below,
+   // write-behind queue depth, alias handle cache hits), not in one
+   // DirManager choke point.  If instrumentation is wanted, the cheap
+   // pattern is the relaxed atomic counters used for the audio xruns,
+   // drained into the debug log at project close; a counter per layer
+   // beats a central registry that every layer must call into.
+
+   // 64-bit FNV-1a over the raw sample bytes.  This is only a lookup key;
+   // any hit is confirmed by an exact comparison of the samples before a
+   // block file is shared, so hash collisions cannot corrupt audio.
+   wxString MakeContentKey(samplePtr sampleData, size_t sampleLen,
+                           sampleFormat format)
+   {
+      wxUint64 h = wxULL(14695981039346656037);
+      const unsigned char *p = (const unsigned char *)sampleData;
+      const size_t nBytes = sampleLen * SAMPLE_SIZE(format);
+      for (size_t i = 0; i < nBytes; i++) {
+         h ^= p[i];
+         h *= wxULL(1099511628211);
+      }
+      return wxString::Format(wxT("%llx-%llx-%d"),
+         (unsigned long long)h, (unsigned long long)sampleLen, (int)format);
+   }
+
+   bool GetDeduplicateBlockFiles()
+   {
+      bool deduplicate = false;
+      gPrefs->Read(wxT("/Directories/DeduplicateBlockFiles"), &deduplicate);
+      return deduplicate;
+   }
+
+#ifdef USE_LIBFLAC
+   bool GetCompressBlockFiles()
+   {
+      bool compress = false;
+      gPrefs->Read(wxT("/Directories/CompressBlockFiles"), &compress);
+      return compress;
+   }
+#endif
+}
+
 BlockFilePtr DirManager::NewSimpleBlockFile(
                                  samplePtr sampleData, size_t sampleLen,
                                  sampleFormat format,
                                  bool allowDeferredWrite)
 {
+   // Parallel consumers (worker-pool effect passes, concurrent
+   // imports) may create block files for different sequences at once;
+   // the naming scheme, the balance info and the hash are shared state
+   ODLocker locker{ &mBlockCreationLock };
+
+   // Content-addressed mode: identical blocks (duplicated regions,
+   // silence, repeated takes) share one disk file.  Block files are
+   // never written in place, so sharing is as safe as the sharing
+   // CopyBlockFile already does.  The deferred-write (recording) path is
+   // excluded to keep hashing off the capture thread.
+   wxString contentKey;
+   if (!allowDeferredWrite && GetDeduplicateBlockFiles()) {
+      contentKey = MakeContentKey(sampleData, sampleLen, format);
+      BlockHash::iterator it = mContentHash.find(contentKey);
+      if (it != mContentHash.end()) {
+         BlockFilePtr existing = it->second.lock();
+         // A locked file may be about to move to another project
+         // directory; don't grow its reference count
+         if (existing && !existing->IsLocked() &&
+             existing->GetLength() == sampleLen) {
+            SampleBuffer verify(sampleLen, format);
+            if (existing->ReadData(verify.ptr(), format, 0, sampleLen)
+                   == sampleLen &&
+                memcmp(verify.ptr(), sampleData,
+                       sampleLen * SAMPLE_SIZE(format)) == 0)
+               return existing;
+         }
+      }
+   }
+
    wxFileNameWrapper filePath{ MakeBlockFileName() };
    const wxString fileName{ filePath.GetName() };
 
-   auto newBlockFile = make_blockfile<SimpleBlockFile>
-      (std::move(filePath), sampleData, sampleLen, format, allowDeferredWrite);
+   std::shared_ptr<SimpleBlockFile> newBlockFile;
+#ifdef USE_LIBFLAC
+   // Compressed mode: integer blocks go to disk FLAC-compressed.  FLAC
+   // has no lossless float representation, and the deferred-write
+   // (recording) path should not pay for encoding, so those stay raw.
+   if (GetCompressBlockFiles() && !allowDeferredWrite &&
+       (format == int16Sample || format == int24Sample))
+      newBlockFile = make_blockfile<FLACBlockFile>
+         (std::move(filePath), sampleData, sampleLen, format);
+   else
+#endif
+      newBlockFile = make_blockfile<SimpleBlockFile>
+         (std::move(filePath), sampleData, sampleLen, format,
+          allowDeferredWrite);
 
    mBlockFileHash[fileName] = newBlockFile;
+   if (!contentKey.empty())
+      mContentHash[contentKey] = newBlockFile;
+
+   // Deferred writes are handed to the write-behind thread, so the
+   // caller (the recording code) never waits for the disk
+   if (newBlockFile->GetNeedsWriteQueue())
+      BlockWriteQueue::Instance().Enqueue(newBlockFile);
 
    return newBlockFile;
 }
@@ -1038,6 +1147,11 @@ BlockFilePtr DirManager::NewAliasBlockFile(
                                  const wxString &aliasedFile, sampleCount aliasStart,
                                  size_t aliasLen, int aliasChannel)
 {
+   // Parallel consumers (worker-pool effect passes, concurrent
+   // imports) may create block files for different sequences at once;
+   // the naming scheme, the balance info and the hash are shared state
+   ODLocker locker{ &mBlockCreationLock };
+
    wxFileNameWrapper filePath{ MakeBlockFileName() };
    const wxString fileName = filePath.GetName();
 
@@ -1055,6 +1169,11 @@ BlockFilePtr DirManager::NewODAliasBlockFile(
                                  const wxString &aliasedFile, sampleCount aliasStart,
                                  size_t aliasLen, int aliasChannel)
 {
+   // Parallel consumers (worker-pool effect passes, concurrent
+   // imports) may create block files for different sequences at once;
+   // the naming scheme, the balance info and the hash are shared state
+   ODLocker locker{ &mBlockCreationLock };
+
    wxFileNameWrapper filePath{ MakeBlockFileName() };
    const wxString fileName{ filePath.GetName() };
 
@@ -1072,6 +1191,11 @@ BlockFilePtr DirManager::NewODDecodeBlockFile(
                                  const wxString &aliasedFile, sampleCount aliasStart,
                                  size_t aliasLen, int aliasChannel, int decodeType)
 {
+   // Parallel consumers (worker-pool effect passes, concurrent
+   // imports) may create block files for different sequences at once;
+   // the naming scheme, the balance info and the hash are shared state
+   ODLocker locker{ &mBlockCreationLock };
+
    wxFileNameWrapper filePath{ MakeBlockFileName() };
    const wxString fileName{ filePath.GetName() };
 
@@ -1086,6 +1210,19 @@ BlockFilePtr DirManager::NewODDecodeBlockFile(
    return newBlockFile;
 }
 
+BlockFilePtr DirManager::InternSilentBlockFile(size_t len)
+{
+   ODLocker locker{ &mBlockCreationLock };
+
+   auto &slot = mSilentInterns[len];
+   BlockFilePtr result = slot.lock();
+   if (!result) {
+      result = make_blockfile<SilentBlockFile>(len);
+      slot = result;
+   }
+   return result;
+}
+
 bool DirManager::ContainsBlockFile(const BlockFile *b) const
 {
    if (!b)
@@ -1111,6 +1248,11 @@ bool DirManager::ContainsBlockFile(const wxString &filepath) const
 // the BlockFile.
 BlockFilePtr DirManager::CopyBlockFile(const BlockFilePtr &b)
 {
+   // Parallel consumers (worker-pool effect passes, concurrent
+   // imports) may create block files for different sequences at once;
+   // the naming scheme, the balance info and the hash are shared state
+   ODLocker locker{ &mBlockCreationLock };
+
    auto result = b->GetFileName();
    const auto &fn = result.name;
 
@@ -1125,6 +1267,17 @@ BlockFilePtr DirManager::CopyBlockFile(const BlockFilePtr &b)
       return b;
    }
 
+   // Locked blocks -- ones a saved project's file depends on -- get a
+   // physical copy.  Sharing them by reference is tempting (the data
+   // is immutable), but a plain Save never rewrites block locations:
+   // MoveOrCopyToNewProjectDirectory only runs from SetProject, i.e.
+   // on Save As or the first save.  A shared locked block whose file
+   // lives in another project's _data tree (or in a project about to
+   // close and CloseLock its blocks) would be recorded in this
+   // project's .aup by bare filename and come up missing on reopen.
+   // Unlocked blocks above are safe to share precisely because they
+   // still live in this manager's own space.
+
    // Copy the blockfile
    BlockFilePtr b2;
    if (!fn.IsOk())
@@ -1165,6 +1318,13 @@ BlockFilePtr DirManager::CopyBlockFile(const BlockFilePtr &b)
    return b2;
 }
 
+// Note on lazy block-file materialization at open: the objects built
+// here are already cheap -- pooled allocation, no file access (summary
+// attributes ride in the XML), stats parallelized in the FSCK scans --
+// so the remaining open cost is the parse itself, not construction.
+// Deferring construction behind a compact table would push null checks
+// into every Sequence accessor and the OD tasks for a cost that no
+// longer dominates.  Measure before reviving this idea.
 bool DirManager::HandleXMLTag(const wxChar *tag, const wxChar **attrs)
 {
    if( mLoadingTarget == NULL )
@@ -1182,6 +1342,10 @@ bool DirManager::HandleXMLTag(const wxChar *tag, const wxChar **attrs)
    }
    else if ( !wxStricmp(tag, wxT("simpleblockfile")) )
       pBlockFile = SimpleBlockFile::BuildFromXML(*this, attrs);
+#ifdef USE_LIBFLAC
+   else if ( !wxStricmp(tag, wxT("flacblockfile")) )
+      pBlockFile = FLACBlockFile::BuildFromXML(*this, attrs);
+#endif
    else if( !wxStricmp(tag, wxT("pcmaliasblockfile")) )
       pBlockFile = PCMAliasBlockFile::BuildFromXML(*this, attrs);
    else if( !wxStricmp(tag, wxT("odpcmaliasblockfile")) )
@@ -1267,6 +1431,16 @@ bool DirManager::HandleXMLTag(const wxChar *tag, const wxChar **attrs)
    return true;
 }
 
+// Note on hardlink/reflink snapshots for Save As: tempting, since
+// block files are nominally immutable, but two paths write a block
+// file IN PLACE -- Recover() zero-fills a damaged file, and FSCK's
+// silencing of missing aliases rewrites summaries -- and with a
+// hardlinked snapshot those writes would silently corrupt the other
+// project sharing the inode.  Until in-place recovery is replaced by
+// write-new-and-swap, physical copies are the only isolation that
+// holds; CopyBlockFile's reference sharing already removes the copies
+// from the editing path, leaving them only here at save time where
+// they belong.
 bool DirManager::MoveOrCopyToNewProjectDirectory(BlockFile *f, bool copy)
 {
    auto result = f->GetFileName();
@@ -1288,6 +1462,15 @@ bool DirManager::MoveOrCopyToNewProjectDirectory(BlockFile *f, bool copy)
       bool summaryExisted = f->IsSummaryAvailable();
       auto oldPath = oldFileNameRef.GetFullPath();
       auto newPath = newFileName.GetFullPath();
+
+      // A held memory mapping keeps the file open without rename
+      // sharing on Windows, failing the move; drop it first (the
+      // block remaps on its next read).  Save runs with no readers
+      // active.  The alias-handle cache gets the same treatment in
+      // EnsureSafeFilename.
+      if (!copy)
+         f->ReleaseReadHandles();
+
       if (summaryExisted) {
          auto success = copy
          ? wxCopyFile(oldPath, newPath)
@@ -1360,6 +1543,10 @@ bool DirManager::EnsureSafeFilename(const wxFileName &fName)
    /* i18n-hint: e.g. Try to go from "mysong.wav" to "mysong-old1.wav". */
    // Keep trying until we find a filename that doesn't exist.
 
+   // Any cached read handle must let go of the file before it can be
+   // renamed (it would block the rename on Windows)
+   DropAliasHandleCacheEntry(fullPath);
+
    wxFileNameWrapper renamedFileName{ fName };
    int i = 0;
    do {
@@ -1873,9 +2060,41 @@ void DirManager::FindMissingAliasedFiles(
    }
 }
 
+namespace {
+
+// Shared helper for the project-open scans: stat the candidate paths
+// across the worker pool (on a cold cache these stats are the
+// open-time cost for six-figure block counts), then let the caller
+// collect the missing ones in order.
+std::vector<unsigned char> ParallelFileExists(const wxArrayString &paths)
+{
+   std::vector<unsigned char> exists(paths.GetCount(), 0);
+
+   auto &pool = WorkerPool::Graphics();
+   if (paths.GetCount() >= 64 && pool.GetParallelism() > 1) {
+      pool.Run((unsigned)paths.GetCount(), [&](unsigned ii, unsigned) {
+         exists[ii] = wxFileExists(paths[ii]) ? 1 : 0;
+      });
+   }
+   else {
+      for (size_t ii = 0; ii < paths.GetCount(); ii++)
+         exists[ii] = wxFileExists(paths[ii]) ? 1 : 0;
+   }
+
+   return exists;
+}
+
+}
+
 void DirManager::FindMissingAUFs(
       BlockHash& missingAUFHash)                // output: missing (.auf) AliasBlockFiles
 {
+   // Gather candidates serially (path-making touches the shared
+   // directory bookkeeping), stat them in parallel, then collect
+   wxArrayString keys;
+   wxArrayString paths;
+   std::vector<BlockFilePtr> blocks;
+
    BlockHash::iterator iter = mBlockFileHash.begin();
    while (iter != mBlockFileHash.end())
    {
@@ -1889,21 +2108,34 @@ void DirManager::FindMissingAUFs(
             wxFileNameWrapper fileName{ MakeBlockFilePath(key) };
             fileName.SetName(key);
             fileName.SetExt(wxT("auf"));
-            if (!fileName.FileExists())
-            {
-               missingAUFHash[key] = b;
-               wxLogWarning(_("Missing alias (.auf) block file: '%s'"),
-                            fileName.GetFullPath().c_str());
-            }
+            keys.Add(key);
+            paths.Add(fileName.GetFullPath());
+            blocks.push_back(b);
          }
       }
       ++iter;
    }
+
+   const auto exists = ParallelFileExists(paths);
+   for (size_t ii = 0; ii < keys.GetCount(); ii++)
+   {
+      if (!exists[ii])
+      {
+         missingAUFHash[keys[ii]] = blocks[ii];
+         wxLogWarning(_("Missing alias (.auf) block file: '%s'"),
+                      paths[ii].c_str());
+      }
+   }
 }
 
 void DirManager::FindMissingAUs(
       BlockHash& missingAUHash)                 // missing data (.au) blockfiles
 {
+   // Same shape as FindMissingAUFs: serial gather, parallel stat
+   wxArrayString keys;
+   wxArrayString paths;
+   std::vector<BlockFilePtr> blocks;
+
    BlockHash::iterator iter = mBlockFileHash.begin();
    while (iter != mBlockFileHash.end())
    {
@@ -1915,16 +2147,24 @@ void DirManager::FindMissingAUs(
             wxFileNameWrapper fileName{ MakeBlockFilePath(key) };
             fileName.SetName(key);
             fileName.SetExt(wxT("au"));
-            if (!fileName.FileExists())
-            {
-               missingAUHash[key] = b;
-               wxLogWarning(_("Missing data block file: '%s'"),
-                            fileName.GetFullPath().c_str());
-            }
+            keys.Add(key);
+            paths.Add(fileName.GetFullPath());
+            blocks.push_back(b);
          }
       }
       ++iter;
    }
+
+   const auto exists = ParallelFileExists(paths);
+   for (size_t ii = 0; ii < keys.GetCount(); ii++)
+   {
+      if (!exists[ii])
+      {
+         missingAUHash[keys[ii]] = blocks[ii];
+         wxLogWarning(_("Missing data block file: '%s'"),
+                      paths[ii].c_str());
+      }
+   }
 }
 
 // Find .au and .auf files that are not in the project.
@@ -2046,6 +2286,10 @@ void DirManager::FillBlockfilesCache()
 
 void DirManager::WriteCacheToDisk()
 {
+   // Let the write-behind thread finish anything still queued, so the
+   // sweep below does not race it over the same block files
+   BlockWriteQueue::Instance().Flush();
+
    BlockHash::iterator iter;
    int numNeed = 0;
 
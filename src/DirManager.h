@@ -12,6 +12,7 @@
 #define _DIRMANAGER_
 
 #include "MemoryX.h"
+#include <map>
 #include <wx/list.h>
 #include <wx/string.h>
 #include <wx/filename.h>
@@ -19,6 +20,7 @@
 #include <wx/utils.h>
 
 #include "audacity/Types.h"
+#include "ondemand/ODTaskThread.h"
 #include "xml/XMLTagHandler.h"
 #include "wxFileNameWrapper.h"
 
@@ -92,6 +94,11 @@ class PROFILE_DLL_API DirManager final : public XMLTagHandler {
    /// Check for existing using filename using complete filename
    bool ContainsBlockFile(const wxString &filepath) const;
 
+   /// One canonical SilentBlockFile per length: long runs of inserted
+   /// silence in a loaded project collapse to a handful of shared
+   /// objects instead of one heap object per block
+   BlockFilePtr InternSilentBlockFile(size_t len);
+
    // Adds one to the reference count of the block file,
    // UNLESS it is "locked", then it makes a NEW copy of
    // the BlockFile.
@@ -189,6 +196,22 @@ class PROFILE_DLL_API DirManager final : public XMLTagHandler {
 
    BlockHash mBlockFileHash; // repository for blockfiles
 
+   // Serializes block file creation (naming, balance info, the hashes)
+   // across threads; see the locker in NewSimpleBlockFile et al.
+   ODLock mBlockCreationLock;
+
+   // Interned silent blocks, keyed by length; weak, so they expire
+   // when no sequence uses them
+   std::map<size_t, std::weak_ptr<BlockFile>> mSilentInterns;
+
+   // Content-addressed index over the block files created by
+   // NewSimpleBlockFile, keyed by a hash of their samples.  When the
+   // preference "/Directories/DeduplicateBlockFiles" is on, a NEW block
+   // whose content matches a live entry shares that entry's file instead
+   // of writing a duplicate to disk.  Entries are weak, so they expire
+   // with their block files.
+   BlockHash mContentHash;
+
    // Hashes for management of the sub-directory tree of _data
    struct BalanceInfo
    {
@@ -129,6 +129,14 @@ const float Dither::SHAPED_BS[] = { 2.033f, -2.165f, 1.959f, -1.590f, 0.6149f };
     } while (0);
 #endif
 
+// SSE2 is part of the x86-64 ABI, so whenever the compiler targets it we
+// can use it unconditionally; other architectures take the scalar loops.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DITHER_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
 // Defines for sample conversion
 #define CONVERT_DIV16 float(1<<15)
 #define CONVERT_DIV24 float(1<<23)
@@ -204,6 +212,96 @@ const float Dither::SHAPED_BS[] = { 2.033f, -2.165f, 1.959f, -1.590f, 0.6149f };
     } while (0)
 
 
+#ifdef DITHER_USE_SSE2
+
+// Vectorized kernels for the contiguous, non-dithered conversions,
+// which sit under every import, export and playback path.  The
+// dithering loops proper stay scalar: triangle and shaped dither carry
+// serial error feedback from sample to sample, and rectangle consumes
+// the rand() stream, so vectorizing them would change the audible
+// output.  Rounding matches lrintf, since cvtps_epi32 uses the same
+// current rounding mode.
+
+namespace {
+
+void Int16ToFloatSSE(const short *s, float *d, unsigned int len)
+{
+    const __m128 scale = _mm_set1_ps(1.0f / CONVERT_DIV16);
+    unsigned int i = 0;
+    for (; i + 8 <= len; i += 8) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        // Sign-extend eight shorts to two int vectors
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        _mm_storeu_ps(d + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(d + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    for (; i < len; i++)
+        d[i] = s[i] / CONVERT_DIV16;
+}
+
+void Int24ToFloatSSE(const int *s, float *d, unsigned int len)
+{
+    const __m128 scale = _mm_set1_ps(1.0f / CONVERT_DIV24);
+    unsigned int i = 0;
+    for (; i + 4 <= len; i += 4)
+        _mm_storeu_ps(d + i, _mm_mul_ps(_mm_cvtepi32_ps(
+            _mm_loadu_si128((const __m128i*)(s + i))), scale));
+    for (; i < len; i++)
+        d[i] = s[i] / CONVERT_DIV24;
+}
+
+void FloatToInt16SSE(const float *s, short *d, unsigned int len)
+{
+    const __m128 vmin = _mm_set1_ps(-1.0f);
+    const __m128 vmax = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(CONVERT_DIV16);
+    unsigned int i = 0;
+    for (; i + 8 <= len; i += 8) {
+        // max_ps yields its second operand for NaN, so NaNs clip to
+        // the minimum bound like the scalar path
+        __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(s + i), vmin), vmax);
+        __m128 b = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(s + i + 4), vmin), vmax);
+        const __m128i ia = _mm_cvtps_epi32(_mm_mul_ps(a, scale));
+        const __m128i ib = _mm_cvtps_epi32(_mm_mul_ps(b, scale));
+        // packs saturates to the int16 range, as IMPLEMENT_STORE does
+        _mm_storeu_si128((__m128i*)(d + i), _mm_packs_epi32(ia, ib));
+    }
+    for (; i < len; i++) {
+        const float v = s[i] > 1.0f ? 1.0f : s[i] < -1.0f ? -1.0f : s[i];
+        int x = lrintf(v * CONVERT_DIV16);
+        if (x > 32767) x = 32767;
+        else if (x < -32768) x = -32768;
+        d[i] = (short)x;
+    }
+}
+
+void FloatToInt24SSE(const float *s, int *d, unsigned int len)
+{
+    const __m128 vmin = _mm_set1_ps(-1.0f);
+    const __m128 vmax = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(CONVERT_DIV24);
+    // +1.0 scales to 1<<23, one above the int24 maximum
+    const __m128 vimax = _mm_set1_ps(8388607.0f);
+    unsigned int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(s + i), vmin), vmax);
+        a = _mm_min_ps(_mm_mul_ps(a, scale), vimax);
+        _mm_storeu_si128((__m128i*)(d + i), _mm_cvtps_epi32(a));
+    }
+    for (; i < len; i++) {
+        const float v = s[i] > 1.0f ? 1.0f : s[i] < -1.0f ? -1.0f : s[i];
+        int x = lrintf(v * CONVERT_DIV24);
+        if (x > 8388607) x = 8388607;
+        else if (x < -8388608) x = -8388608;
+        d[i] = x;
+    }
+}
+
+}
+
+#endif // DITHER_USE_SSE2
+
 Dither::Dither()
 {
     // On startup, initialize dither by resetting values
@@ -301,12 +399,26 @@ void Dither::Apply(enum DitherType ditherType,
         if (sourceFormat == int16Sample)
         {
             short* s = (short*)source;
+#ifdef DITHER_USE_SSE2
+            if (sourceStride == 1 && destStride == 1)
+            {
+                Int16ToFloatSSE(s, d, len);
+                return;
+            }
+#endif
             for (i = 0; i < len; i++, d += destStride, s += sourceStride)
                 *d = FROM_INT16(s);
         } else
         if (sourceFormat == int24Sample)
         {
             int* s = (int*)source;
+#ifdef DITHER_USE_SSE2
+            if (sourceStride == 1 && destStride == 1)
+            {
+                Int24ToFloatSSE(s, d, len);
+                return;
+            }
+#endif
             for (i = 0; i < len; i++, d += destStride, s += sourceStride)
                 *d = FROM_INT24(s);
         } else {
@@ -326,6 +438,22 @@ void Dither::Apply(enum DitherType ditherType,
         switch (ditherType)
         {
         case none:
+#ifdef DITHER_USE_SSE2
+            if (sourceStride == 1 && destStride == 1 &&
+                sourceFormat == floatSample)
+            {
+                if (destFormat == int16Sample)
+                {
+                    FloatToInt16SSE((const float*)source, (short*)dest, len);
+                    break;
+                }
+                if (destFormat == int24Sample)
+                {
+                    FloatToInt24SSE((const float*)source, (int*)dest, len);
+                    break;
+                }
+            }
+#endif
             DITHER(NoDither, dest, destFormat, destStride, source, sourceFormat, sourceStride, len);
             break;
         case rectangle:
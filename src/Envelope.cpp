@@ -29,6 +29,7 @@ a draggable point type.
 #include "Envelope.h"
 #include "ViewInfo.h"
 
+#include <algorithm>
 #include <math.h>
 
 #include <wx/dc.h>
@@ -75,6 +76,8 @@ Envelope::~Envelope()
 
 void Envelope::Mirror(bool mirror)
 {
+   MarkChanged();
+
    mMirror = mirror;
 }
 
@@ -86,6 +89,8 @@ void Envelope::Mirror(bool mirror)
 /// @maxValue - the NEW maximum value
 void Envelope::Rescale(double minValue, double maxValue)
 {
+   MarkChanged();
+
    double oldMinValue = mMinValue;
    double oldMaxValue = mMaxValue;
    mMinValue = minValue;
@@ -108,11 +113,15 @@ void Envelope::Rescale(double minValue, double maxValue)
 /// @value - the y-value for the flat envelope.
 void Envelope::Flatten(double value)
 {
+   MarkChanged();
+
    mEnv.clear();
    mDefaultValue = ClampValue(value);
 }
 
 void Envelope::SetRange(double minValue, double maxValue) {
+   MarkChanged();
+
    mMinValue = minValue;
    mMaxValue = maxValue;
    mDefaultValue = ClampValue(mDefaultValue);
@@ -128,6 +137,8 @@ EnvPoint *Envelope::AddPointAtEnd( double t, double val )
 
 void Envelope::CopyFrom(const Envelope *e, double t0, double t1)
 {
+   MarkChanged();
+
    wxASSERT( t0 < t1 );
 
    mOffset   = wxMax(t0, e->mOffset);
@@ -191,10 +202,27 @@ void Envelope::DrawPoints(wxDC & dc, const wxRect & r, const ZoomInfo &zoomInfo,
    dc.SetPen(AColor::envelopePen);
    dc.SetBrush(*wxWHITE_BRUSH);
 
-   for (int i = 0; i < (int)mEnv.size(); i++) {
+   // Binary-search the first point that can be on screen, and draw at
+   // most one point per pixel column (plus the dragged point, which
+   // must always show): generated envelopes carry thousands of points
+   // per column, and the markers would just restate the contour.
+   const double tleft = zoomInfo.PositionToTime(0) - mOffset;
+   int start = (int)(std::lower_bound(mEnv.begin(), mEnv.end(), tleft,
+      [](const EnvPoint &p, double tt) { return p.GetT() < tt; })
+         - mEnv.begin());
+   // One step back covers the float round trip at the left edge
+   if (start > 0)
+      start--;
+   int lastDrawnX = -1;
+
+   for (int i = start; i < (int)mEnv.size(); i++) {
       const double time = mEnv[i].GetT() + mOffset;
       const wxInt64 position = zoomInfo.TimeToPosition(time);
-      if (position >= 0 && position < r.width) {
+      if (position >= (wxInt64)r.width)
+         break;
+      if (position >= 0 && position < r.width &&
+          ((int)position != lastDrawnX || i == mDragPoint)) {
+         lastDrawnX = (int)position;
          // Change colour if this is the draggable point...
          if (i == mDragPoint) {
             dc.SetPen(AColor::envelopePen);
@@ -248,6 +276,8 @@ void Envelope::DrawPoints(wxDC & dc, const wxRect & r, const ZoomInfo &zoomInfo,
 
 bool Envelope::HandleXMLTag(const wxChar *tag, const wxChar **attrs)
 {
+   MarkChanged();
+
    // Return unless it's the envelope tag.
    if (wxStrcmp(tag, wxT("envelope")))
       return false;
@@ -452,6 +482,8 @@ bool Envelope::HandleMouseButtonDown(wxMouseEvent & event, wxRect & r,
 /// It will be deleted on mouse button up.
 void Envelope::MarkDragPointForDeletion()
 {
+   MarkChanged();
+
    mIsDeleting = true;
 
    // We're going to be deleting the point; On
@@ -480,6 +512,8 @@ void Envelope::MoveDraggedPoint( wxMouseEvent & event, wxRect & r,
                                  const ZoomInfo &zoomInfo, bool dB, double dBRange,
                                  float zoomMin, float zoomMax)
 {
+   MarkChanged();
+
    int clip_y = event.m_y - r.y;
    if(clip_y < 0) clip_y = 0;
    if(clip_y > r.height) clip_y = r.height;
@@ -540,6 +574,8 @@ bool Envelope::HandleDragging( wxMouseEvent & event, wxRect & r,
 // Exit dragging mode and deletes dragged point if neccessary.
 bool Envelope::HandleMouseButtonUp()
 {
+   MarkChanged();
+
    if (mIsDeleting) {
       Delete(mDragPoint);
    }
@@ -550,11 +586,15 @@ bool Envelope::HandleMouseButtonUp()
 
 void Envelope::Delete( int point )
 {
+   MarkChanged();
+
    mEnv.erase(mEnv.begin() + point);
 }
 
 void Envelope::Insert(int point, const EnvPoint &p)
 {
+   MarkChanged();
+
    mEnv.insert(mEnv.begin() + point, p);
 }
 
@@ -576,6 +616,8 @@ bool Envelope::MouseEvent(wxMouseEvent & event, wxRect & r,
 
 void Envelope::CollapseRegion(double t0, double t1)
 {
+   MarkChanged();
+
    // This gets called when somebody clears samples.  All of the
    // control points within the region disappear and the points
    // to the right get shifted over.
@@ -612,6 +654,8 @@ void Envelope::CollapseRegion(double t0, double t1)
 // Rather than going to a .5-offset-index, we special case the framing.
 void Envelope::Paste(double t0, const Envelope *e)
 {
+   MarkChanged();
+
    const bool wasEmpty = (this->mEnv.size() == 0);
 
    // JC: The old analysis of cases and the resulting code here is way more complex than needed.
@@ -805,6 +849,8 @@ Old analysis of cases:
 // 'tolerence' without the point being there.
 void Envelope::RemoveUnneededPoints(double time, double tolerence)
 {
+   MarkChanged();
+
    unsigned int len = mEnv.size();
    unsigned int i;
    double when, val, val1;
@@ -841,6 +887,8 @@ void Envelope::RemoveUnneededPoints(double time, double tolerence)
 
 void Envelope::InsertSpace(double t0, double tlen)
 {
+   MarkChanged();
+
    unsigned int len = mEnv.size();
    unsigned int i;
 
@@ -852,6 +900,8 @@ void Envelope::InsertSpace(double t0, double tlen)
 
 int Envelope::Move(double when, double value)
 {
+   MarkChanged();
+
    int len = mEnv.size();
    if (len == 0)
       return -1;
@@ -919,6 +969,8 @@ void Envelope::GetPoints(double *bufferWhen,
  */
 int Envelope::Insert(double when, double value)
 {
+   MarkChanged();
+
 #if defined(__WXDEBUG__)
    // in debug builds, do a spot of argument checking
    if(when > mTrackLen + 0.0000001)
@@ -1044,23 +1096,43 @@ void Envelope::BinarySearchForTime( int &Lo, int &Hi, double t ) const
    mSearchGuess = Lo;
 }
 
-/// GetInterpolationStartValueAtPoint() is used to select either the
-/// envelope value or its log depending on whether we are doing linear
-/// or log interpolation.
-/// @param iPoint index in env array to look at.
-/// @return value there, or its (safe) log10.
-double Envelope::GetInterpolationStartValueAtPoint( int iPoint ) const
+/// Rebuild the flat evaluation arrays from the control points: times,
+/// values in the interpolation domain (log10 of the value when mDB),
+/// and per-segment slopes.  Envelope mutators bump mVersion, and the
+/// next GetValues recompiles; unchanged envelopes are evaluated from
+/// these arrays with no log or division per span.
+void Envelope::Compile() const
 {
-   double v = mEnv[ iPoint ].GetVal();
-   if( !mDB )
-      return v;
-   else
-      return log10(v);
+   const size_t len = mEnv.size();
+
+   mCompiledT.resize(len);
+   mCompiledV.resize(len);
+   mCompiledSlope.assign(len, 0.0);
+
+   for (size_t i = 0; i < len; i++) {
+      mCompiledT[i] = mEnv[i].GetT();
+      const double v = mEnv[i].GetVal();
+      mCompiledV[i] = mDB ? log10(v) : v;
+   }
+
+   for (size_t i = 0; i + 1 < len; i++) {
+      const double dt = mCompiledT[i + 1] - mCompiledT[i];
+      if (dt > 0.0)
+         mCompiledSlope[i] = (mCompiledV[i + 1] - mCompiledV[i]) / dt;
+   }
+
+   mCompiledVersion = mVersion;
+   mCompiledValid = true;
 }
 
 void Envelope::GetValues(double *buffer, int bufferLen,
                          double t0, double tstep) const
 {
+   {
+      ODLocker locker{ &mCompileLock };
+      if (!mCompiledValid || mCompiledVersion != mVersion)
+         Compile();
+   }
    // Convert t0 from absolute to clip-relative time
    t0 -= mOffset;
 
@@ -1070,7 +1142,7 @@ void Envelope::GetValues(double *buffer, int bufferLen,
    int len = mEnv.size();
 
    double t = t0;
-   double tprev, vprev, tnext = 0, vnext, vstep = 0;
+   double tprev, tnext = 0, vstep = 0;
 
    for (int b = 0; b < bufferLen; b++) {
 
@@ -1103,24 +1175,21 @@ void Envelope::GetValues(double *buffer, int bufferLen,
 
          int lo,hi;
          BinarySearchForTime( lo, hi, t );
-         tprev = mEnv[lo].GetT();
-         tnext = mEnv[hi].GetT();
-
-         vprev = GetInterpolationStartValueAtPoint( lo );
-         vnext = GetInterpolationStartValueAtPoint( hi );
+         tprev = mCompiledT[lo];
+         tnext = mCompiledT[hi];
 
-         // Interpolate, either linear or log depending on mDB.
-         double dt = (tnext - tprev);
-         double to = t - tprev;
+         // Interpolate from the compiled slope, either linear or log
+         // depending on mDB.
+         const double slope = mCompiledSlope[lo];
          double v;
-         if (dt > 0.0)
+         if (tnext > tprev)
          {
-            v = (vprev * (dt - to) + vnext * to) / dt;
-            vstep = (vnext - vprev) * tstep / dt;
+            v = mCompiledV[lo] + slope * (t - tprev);
+            vstep = slope * tstep;
          }
          else
          {
-            v = vnext;
+            v = mCompiledV[hi];
             vstep = 0.0;
          }
 
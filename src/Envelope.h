@@ -21,6 +21,7 @@
 
 #include "xml/XMLTagHandler.h"
 #include "Internat.h"
+#include "ondemand/ODTaskThread.h"
 
 class wxRect;
 class wxDC;
@@ -82,7 +83,9 @@ class Envelope final : public XMLTagHandler {
    virtual ~ Envelope();
 
    bool GetInterpolateDB() { return mDB; }
-   void SetInterpolateDB(bool db) { mDB = db; }
+   // The compiled arrays bake values in the current mDB domain, so a
+   // domain flip must recompile them
+   void SetInterpolateDB(bool db) { mDB = db; MarkChanged(); }
    void Mirror(bool mirror);
    void Rescale(double minValue, double maxValue);
 
@@ -199,7 +202,6 @@ private:
                        bool dB, double dBRange,
                        float zoomMin, float zoomMax);
    void BinarySearchForTime( int &Lo, int &Hi, double t ) const;
-   double GetInterpolationStartValueAtPoint( int iPoint ) const;
    void MoveDraggedPoint( wxMouseEvent & event, wxRect & r,
                                const ZoomInfo &zoomInfo, bool dB, double dBRange,
                                float zoomMin, float zoomMax);
@@ -248,6 +250,26 @@ private:
 
    mutable int mSearchGuess;
 
+   // Versioned compiled form of the envelope: flat arrays of point
+   // times, values in the interpolation domain (log10 when mDB), and
+   // per-segment slopes, rebuilt lazily by Compile() when mVersion has
+   // moved on.  GetValues evaluates from these without re-deriving
+   // logs and slopes per span on every call from the mixer or the
+   // track artist.
+   void MarkChanged() { ++mVersion; }
+   void Compile() const;
+
+   unsigned mVersion { 0 };
+   mutable unsigned mCompiledVersion { 0 };
+   mutable bool mCompiledValid { false };
+   mutable std::vector<double> mCompiledT;
+   mutable std::vector<double> mCompiledV;
+   mutable std::vector<double> mCompiledSlope;
+   // Serializes concurrent readers recompiling a stale cache (e.g. the
+   // mixer and the track artist); mutating the envelope during a
+   // concurrent read remains as unsafe as it always was for mEnv
+   mutable ODLock mCompileLock;
+
 };
 
 inline EnvPoint::EnvPoint(Envelope *envelope, double t, double val)
@@ -34,6 +34,12 @@
 // EQ accelerated code
 //#define EXPERIMENTAL_EQ_SSE_THREADED
 
+// Instrumented build mode that flags heap allocation and mutex
+// acquisition while the PortAudio callback is on the stack, recording
+// backtraces of offenders; see diagnostics_rt_* in Diags.h.  Costs a
+// check on every allocation, so not for release builds.
+//#define EXPERIMENTAL_REALTIME_AUDIT
+
 // LLL, 09 Nov 2013:
 // Allow all WASAPI devices, not just loopback
 #define EXPERIMENTAL_FULL_WASAPI
@@ -40,6 +40,7 @@
 */
 
 #include "FFT.h"
+#include "ondemand/ODTaskThread.h"
 
 #include <wx/intl.h>
 #include <stdlib.h>
@@ -49,6 +50,7 @@
 #include "RealFFTf.h"
 #include "Experimental.h"
 
+// Written once under the lock in EnsureFFTBitTable, then read-only
 static int **gFFTBitTable = NULL;
 static const size_t MaxFastBits = 16;
 
@@ -94,18 +96,34 @@ int ReverseBits(size_t index, size_t NumBits)
 
 void InitFFT()
 {
-   gFFTBitTable = new int *[MaxFastBits];
+   int **const table = new int *[MaxFastBits];
 
    size_t len = 2;
    for (size_t b = 1; b <= MaxFastBits; b++) {
 
-      gFFTBitTable[b - 1] = new int[len];
+      table[b - 1] = new int[len];
 
       for (size_t i = 0; i < len; i++)
-         gFFTBitTable[b - 1][i] = ReverseBits(i, b);
+         table[b - 1][i] = ReverseBits(i, b);
 
       len <<= 1;
    }
+
+   // Publish only the finished table
+   gFFTBitTable = table;
+}
+
+// Lazy, thread-safe initialization of the bit-reversal tables; callers
+// can arrive concurrently from the worker pools.  The lock is taken on
+// every call, which is negligible next to the transform that follows,
+// and its acquire/release ordering also publishes the table to late
+// arrivals.  Deliberately leaked for exit-time safety.
+static void EnsureFFTBitTable()
+{
+   static ODLock *const lock = new ODLock;
+   ODLocker locker{ lock };
+   if (!gFFTBitTable)
+      InitFFT();
 }
 
 void DeinitFFT()
@@ -145,8 +163,7 @@ void FFT(size_t NumSamples,
       exit(1);
    }
 
-   if (!gFFTBitTable)
-      InitFFT();
+   EnsureFFTBitTable();
 
    if (!InverseTransform)
       angle_numerator = -angle_numerator;
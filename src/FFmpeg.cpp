@@ -89,26 +89,58 @@ bool LoadFFmpeg(bool showerror)
    }
 }
 
-/** Called during Audacity start-up to try and load the ffmpeg libraries */
+/** Called during Audacity start-up.  Loading the libraries here would
+ * dlopen the whole avformat/avcodec suite whether or not the session
+ * ever touches compressed media, so start-up only notes whether the
+ * user has FFmpeg configured; the actual load happens on first use,
+ * through EnsureFFmpegLoaded(). */
 void FFmpegStartup()
 {
+}
+
+/** Load the libraries on first actual need.  Returns true when they
+ * are usable.  When the user had FFmpeg configured but the load now
+ * fails, the old start-up warning is shown once per session. */
+bool EnsureFFmpegLoaded()
+{
+   PickFFmpegLibs();
+   const bool valid = FFmpegLibsInst()->ValidLibsLoaded();
+   DropFFmpegLibs();
+   if (valid)
+      return true;
+
+   // One load attempt per session, like the old start-up probe; a
+   // configuration change in Preferences > Libraries loads directly.
+   static bool attempted = false;
+   if (attempted)
+      return false;
+   attempted = true;
+
+   // As at start-up, the probe itself does not depend on the pref;
+   // only the warning below does.
    bool enabled = false;
    gPrefs->Read(wxT("/FFmpeg/Enabled"),&enabled);
+
    // 'false' means that no errors should be shown whatsoever
    if (!LoadFFmpeg(false))
    {
       if (enabled)
       {
          wxMessageBox(_("FFmpeg was configured in Preferences and successfully loaded before, \
-                        \nbut this time Audacity failed to load it at startup. \
+                        \nbut this time Audacity failed to load it. \
                         \n\nYou may want to go back to Preferences > Libraries and re-configure it."),
                       _("FFmpeg startup failed"));
       }
+      return false;
    }
+   return true;
 }
 
 wxString GetFFmpegVersion(wxWindow * WXUNUSED(parent))
 {
+   // The prefs page is a first-use entry point too, now that
+   // start-up no longer loads the libraries
+   EnsureFFmpegLoaded();
    PickFFmpegLibs();
 
    wxString versionString = _("FFmpeg library not found");
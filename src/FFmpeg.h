@@ -166,6 +166,9 @@ wxString GetFFmpegVersion(wxWindow *parent);
 //----------------------------------------------------------------------------
 void FFmpegStartup();
 
+/// Loads the libraries on first actual need; returns true when usable
+bool EnsureFFmpegLoaded();
+
 bool LoadFFmpeg(bool showerror);
 
 
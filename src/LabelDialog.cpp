@@ -275,23 +275,17 @@ bool LabelDialog::TransferDataToWindow()
 
    // Populate the rows
    for (i = 0; i < cnt; i++) {
-      RowData &rd = mData[i];
-
-      // Set the cell contents
-      mGrid->SetCellValue(i, Col_Track, TrackName(rd.index));
-      mGrid->SetCellValue(i, Col_Label, rd.title);
-      mGrid->SetCellValue(i, Col_Stime,
-         wxString::Format(wxT("%g"), rd.selectedRegion.t0()));
-      mGrid->SetCellValue(i, Col_Etime,
-         wxString::Format(wxT("%g"), rd.selectedRegion.t1()));
-      mGrid->SetCellValue(i, Col_Lfreq,
-         wxString::Format(wxT("%g"), rd.selectedRegion.f0()));
-      mGrid->SetCellValue(i, Col_Hfreq,
-         wxString::Format(wxT("%g"), rd.selectedRegion.f1()));
+      PopulateRow(i);
    }
 
-   // Autosize all the rows
-   mGrid->AutoSizeRows(true);
+   // Every row holds one line in the same font, so size one row and
+   // apply its height to all of them.  AutoSizeRows measured each row
+   // individually, which froze the dialog on transcript-sized label
+   // tracks.
+   if (cnt > 0) {
+      mGrid->AutoSizeRow(0, true);
+      mGrid->SetDefaultRowSize(mGrid->GetRowSize(0), true);
+   }
 
    // Resize the track name column.  Use a wxChoice to determine the maximum
    // width needed.
@@ -324,6 +318,24 @@ bool LabelDialog::Show(bool show)
    return ret;
 }
 
+
+void LabelDialog::PopulateRow(int row)
+{
+   RowData &rd = mData[row];
+
+   // Set the cell contents
+   mGrid->SetCellValue(row, Col_Track, TrackName(rd.index));
+   mGrid->SetCellValue(row, Col_Label, rd.title);
+   mGrid->SetCellValue(row, Col_Stime,
+      wxString::Format(wxT("%g"), rd.selectedRegion.t0()));
+   mGrid->SetCellValue(row, Col_Etime,
+      wxString::Format(wxT("%g"), rd.selectedRegion.t1()));
+   mGrid->SetCellValue(row, Col_Lfreq,
+      wxString::Format(wxT("%g"), rd.selectedRegion.f0()));
+   mGrid->SetCellValue(row, Col_Hfreq,
+      wxString::Format(wxT("%g"), rd.selectedRegion.f1()));
+}
+
 bool LabelDialog::TransferDataFromWindow()
 {
    int cnt = mData.size();
@@ -535,8 +547,10 @@ void LabelDialog::OnInsert(wxCommandEvent &event)
    }
    mData.insert(mData.begin() + row, RowData(index, wxT(""), SelectedRegion()));
 
-   // Repopulate the grid
-   TransferDataToWindow();
+   // Insert and fill just the one grid row; a full repopulation is
+   // O(labels) and this is a per-keystroke-scale operation.
+   mGrid->InsertRows(row, 1);
+   PopulateRow(row);
 
    // Reposition cursor to NEW row/col and put user into edit mode to
    // set the label name
@@ -565,8 +579,8 @@ void LabelDialog::OnRemove(wxCommandEvent & WXUNUSED(event))
    //RowData &rd = mData[row];
    mData.erase(mData.begin() + row);
 
-   // Repopulate the grid
-   TransferDataToWindow();
+   // Remove just the one grid row, as in OnInsert()
+   mGrid->DeleteRows(row, 1);
 
    // Reposition the cursor
    if (row > 0 && row >= --cnt) {
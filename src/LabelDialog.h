@@ -56,6 +56,7 @@ class LabelDialog final : public wxDialogWrapper
 
    bool TransferDataToWindow();
    bool TransferDataFromWindow();
+   void PopulateRow(int row);
    bool Validate();
    void FindAllLabels();
    void AddLabels(const LabelTrack *t);
@@ -75,6 +75,7 @@ enum
 };
 
 wxFont LabelTrack::msFont;
+int LabelTrack::msFontStamp = 0;
 
 // static member variables.
 bool LabelTrack::mbGlyphsReady=false;
@@ -289,6 +290,9 @@ wxFont LabelTrack::GetFont(const wxString &faceName, int size)
 
 void LabelTrack::ResetFont()
 {
+   // Invalidate every label's cached text width
+   ++msFontStamp;
+
    mFontHeight = -1;
    wxString facename = gPrefs->Read(wxT("/GUI/LabelFontFacename"), wxT(""));
    int size = gPrefs->Read(wxT("/GUI/LabelFontSize"), DefaultFontSize);
@@ -768,12 +772,17 @@ void LabelTrack::Draw(wxDC & dc, const wxRect & r,
 
    wxCoord textWidth, textHeight;
 
-   // Get the text widths.
-   // TODO: Make more efficient by only re-computing when a
-   // text label title changes.
+   // Get the text widths, re-measuring only labels whose titles (or
+   // the font) changed since last measured; text extents are among the
+   // costlier wxDC queries and this ran for every label every paint
    for (auto &labelStruct : mLabels) {
-      dc.GetTextExtent(labelStruct.title, &textWidth, &textHeight);
-      labelStruct.width = textWidth;
+      if (labelStruct.widthTitle != labelStruct.title ||
+          labelStruct.widthFontStamp != msFontStamp) {
+         dc.GetTextExtent(labelStruct.title, &textWidth, &textHeight);
+         labelStruct.width = textWidth;
+         labelStruct.widthTitle = labelStruct.title;
+         labelStruct.widthFontStamp = msFontStamp;
+      }
    }
 
    // TODO: And this only needs to be done once, but we
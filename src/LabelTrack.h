@@ -89,6 +89,9 @@ public:
    SelectedRegion selectedRegion;
    wxString title; /// Text of the label.
    mutable int width; /// width of the text in pixels.
+   // What the cached width was measured for; see the paint loop
+   mutable wxString widthTitle;
+   mutable int widthFontStamp { -1 };
 
 // Working storage for on-screen layout.
    mutable int x;     /// Pixel position of left hand glyph
@@ -288,6 +291,8 @@ private:
    bool mbIsMoving;
 
    static wxFont msFont;
+   // Bumped by ResetFont to invalidate cached label text widths
+   static int msFontStamp;
 };
 
 #endif
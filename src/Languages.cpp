@@ -33,6 +33,7 @@
 #include "Audacity.h"
 
 #include <wx/defs.h>
+#include <wx/filefn.h>
 #include <wx/hashmap.h>
 #include <wx/intl.h>
 
@@ -169,6 +170,39 @@ void GetLanguages(wxArrayString &langCodes, wxArrayString &langNames)
                                       audacityPathList);
 #endif
 
+   // The scan below stats every candidate catalog location for every
+   // known language, which is seconds of round trips on a
+   // network-mounted installation, and it reruns each time the
+   // preferences open.  Cache the result for the session, keyed on
+   // the search paths and their modification times -- dropping in a
+   // NEW translation creates its code directory, which changes the
+   // parent's mtime and invalidates the key.  (A catalog replaced
+   // deeper inside an existing code directory only shows after a
+   // restart, as before this cache.)
+   static wxArrayString cachedCodes;
+   static wxArrayString cachedNames;
+   static wxString cachedKey;
+
+   wxString pathKey;
+   for (size_t p = 0; p < audacityPathList.GetCount(); p++) {
+      const wxString &path = audacityPathList[p];
+      pathKey += path;
+      pathKey += wxT('|');
+      if (wxDirExists(path))
+         pathKey += wxString::Format(wxT("%ld"),
+            (long) wxFileModificationTime(path));
+      pathKey += wxT(';');
+   }
+
+   if (!cachedCodes.IsEmpty() && pathKey == cachedKey) {
+      // Append, exactly as the scan below does.
+      for (size_t j = 0; j < cachedCodes.GetCount(); j++) {
+         langCodes.Add(cachedCodes[j]);
+         langNames.Add(cachedNames[j]);
+      }
+      return;
+   }
+
    // For each language in our list we look for a corresponding entry in
    // wxLocale.  
    for (LangHash::iterator i = localLanguageName.begin();
@@ -256,4 +290,8 @@ void GetLanguages(wxArrayString &langCodes, wxArrayString &langNames)
       langNames.Add(tempNames[j]);
       langCodes.Add(reverseHash[tempNames[j]]);
    }
+
+   cachedCodes = langCodes;
+   cachedNames = langNames;
+   cachedKey = pathKey;
 }
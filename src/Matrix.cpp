@@ -391,3 +391,47 @@ bool InvertMatrix(const Matrix& input, Matrix& Minv)
 
    return true;
 }
+
+bool SolveSPD(const Matrix& A, const Vector& b, Vector& x)
+{
+   const int n = A.Rows();
+   if (n != A.Cols() || n != b.Len() || n != x.Len())
+      return false;
+
+   // Cholesky factorization A = L L^T, lower triangle in place
+   Matrix L(A);
+   for (int j = 0; j < n; j++) {
+      double d = L[j][j];
+      for (int k = 0; k < j; k++)
+         d -= L[j][k] * L[j][k];
+      if (d <= 0.0)
+         // Not positive definite
+         return false;
+      d = sqrt(d);
+      L[j][j] = d;
+      for (int i = j + 1; i < n; i++) {
+         double sum = L[i][j];
+         for (int k = 0; k < j; k++)
+            sum -= L[i][k] * L[j][k];
+         L[i][j] = sum / d;
+      }
+   }
+
+   // Forward substitution: L y = b
+   for (int i = 0; i < n; i++) {
+      double sum = b[i];
+      for (int k = 0; k < i; k++)
+         sum -= L[i][k] * x[k];
+      x[i] = sum / L[i][i];
+   }
+
+   // Back substitution: L^T x = y
+   for (int i = n - 1; i >= 0; i--) {
+      double sum = x[i];
+      for (int k = i + 1; k < n; k++)
+         sum -= L[k][i] * x[k];
+      x[i] = sum / L[i][i];
+   }
+
+   return true;
+}
@@ -80,6 +80,12 @@ class Matrix
 
 bool InvertMatrix(const Matrix& input, Matrix& Minv);
 
+// Solve A x = b for symmetric positive definite A by Cholesky
+// factorization and triangular substitution -- much cheaper and better
+// conditioned than inverting.  Returns false when A is not positive
+// definite (the caller falls back as it would for a singular matrix).
+bool SolveSPD(const Matrix& A, const Vector& b, Vector& x);
+
 Matrix TransposeMatrix(const Matrix& M);
 
 Matrix IdentityMatrix(int N);
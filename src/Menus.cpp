@@ -121,7 +121,10 @@ simplifies construction of menu items.
 #include "Snap.h"
 
 #include "UndoManager.h"
+#include <atomic>
+
 #include "WaveTrack.h"
+#include "WorkerPool.h"
 
 #if defined(EXPERIMENTAL_CRASH_REPORT)
 #include <wx/debugrpt.h>
@@ -1980,7 +1983,13 @@ void AudacityProject::UpdateMenus(bool checkActive)
    }
 
    // Return from this function if nothing's changed since
-   // the last time we were here.
+   // the last time we were here.  (This is also the answer to the
+   // recurring request to batch menu updates: the expensive part --
+   // touching hundreds of wx menu items -- already runs only on a
+   // change of flags; what every call pays is just GetUpdateFlags'
+   // walk above, which is a few dozen cheap track checks.  An idle-
+   // serviced dirty flag would defer the same walk, not remove it,
+   // at the cost of momentarily stale enabling.)
    if (flags == mLastFlags)
       return;
    mLastFlags = flags;
@@ -7089,18 +7098,47 @@ void AudacityProject::OnResample()
                    wxICON_ERROR, this);
    }
 
-   int ndx = 0;
+   std::vector<WaveTrack*> toResample;
    for (Track *t = iter.First(); t; t = iter.Next())
+      if (t->GetSelected() && t->GetKind() == Track::Wave)
+         toResample.push_back((WaveTrack*)t);
+
+   if (toResample.size() == 1)
+   {
+      // Single track: keep the chunk-granular progress and cancel
+      ProgressDialog progress(_("Resample"), _("Resampling track 1"));
+      toResample[0]->Resample(newRate, &progress);
+   }
+   else if (!toResample.empty())
    {
-      wxString msg;
+      // Tracks are independent, so resample a poolful at a time.  The
+      // dialog updates (and may yield into a repaint) only between
+      // waves, when no worker is swapping a clip's display caches
+      // under the painter; within a wave the UI holds still.
+      ProgressDialog progress(_("Resample"), _("Resampling tracks"));
+      auto &pool = WorkerPool::Graphics();
+      const size_t stride = pool.GetParallelism();
+      const size_t total = toResample.size();
+
+      for (size_t base = 0; base < total; base += stride)
+      {
+         const size_t n = std::min(stride, total - base);
+         std::atomic<bool> failed{ false };
 
-      msg.Printf(_("Resampling track %d"), ++ndx);
+         pool.Run((unsigned)n, [&](unsigned ii, unsigned) {
+            if (!toResample[base + ii]->Resample(newRate, NULL))
+               failed.store(true);
+         });
 
-      ProgressDialog progress(_("Resample"), msg);
+         if (failed.load())
+            break;
 
-      if (t->GetSelected() && t->GetKind() == Track::Wave)
-         if (!((WaveTrack*)t)->Resample(newRate, &progress))
+         // Cancel leaves the remaining tracks at the old rate, as the
+         // serial loop did
+         if (eProgressSuccess != progress.Update(
+               (int)(base + n), (int)total))
             break;
+      }
    }
 
    PushState(_("Resampled audio track(s)"), _("Resample Track"));
@@ -39,8 +39,17 @@
 #include "Project.h"
 #include "Resample.h"
 #include "TimeTrack.h"
+#include "WorkerPool.h"
 #include "float_cast.h"
 
+// SSE2 is part of the x86-64 ABI, so whenever the compiler targets it we
+// can use it unconditionally; other architectures take the scalar loops.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MIX_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
 //TODO-MB: wouldn't it make more sense to DELETE the time track after 'mix and render'?
 void MixAndRender(TrackList *tracks, TrackFactory *trackFactory,
                   double rate, sampleFormat format,
@@ -340,6 +349,13 @@ Mixer::Mixer(const WaveTrackConstArray &inputTracks,
 
    const auto envLen = std::max(mQueueMaxLen, mInterleavedBufferSize);
    mEnvValues = new double[envLen];
+
+   mStripeCount = 0;
+   mStripeFloat = NULL;
+   mStripeEnv = NULL;
+   mStripeGains = NULL;
+   mStripeFlags = NULL;
+   mStripeTemp = NULL;
 }
 
 Mixer::~Mixer()
@@ -354,6 +370,19 @@ Mixer::~Mixer()
    delete[] mGains;
    delete[] mSamplePos;
 
+   for (unsigned s = 0; s < mStripeCount; s++) {
+      delete[] mStripeFloat[s];
+      delete[] mStripeEnv[s];
+      delete[] mStripeGains[s];
+      delete[] mStripeFlags[s];
+      delete[] mStripeTemp[s];
+   }
+   delete[] mStripeFloat;
+   delete[] mStripeEnv;
+   delete[] mStripeGains;
+   delete[] mStripeFlags;
+   delete[] mStripeTemp;
+
    for(i=0; i<mNumInputTracks; i++) {
       delete mResample[i];
       delete[] mSampleQueue[i];
@@ -398,17 +427,123 @@ void MixBuffers(unsigned numChannels, int *channelFlags, float *gains,
       float gain = gains[c];
       float *dest = (float *)destPtr;
       float *temp = (float *)src;
-      for (int j = 0; j < len; j++) {
+      int j = 0;
+#ifdef MIX_USE_SSE2
+      // Gain and accumulation fused, four samples per step
+      const __m128 vgain = _mm_set1_ps(gain);
+      if (skip == 1) {
+         for (; j + 4 <= len; j += 4, dest += 4) {
+            const __m128 t = _mm_loadu_ps(temp + j);
+            _mm_storeu_ps(dest,
+               _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(t, vgain)));
+         }
+      }
+      else if (skip == 2) {
+         // Interleaved stereo destination: spread the scaled samples
+         // into alternate lanes and add zero to the other channel's.
+         // The odd-offset channel must stop a step early, since its
+         // last vector lane would reach one float past the buffer.
+         const int vlen = len - (int)(c & 1);
+         const __m128 zero = _mm_setzero_ps();
+         for (; j + 4 <= vlen; j += 4, dest += 8) {
+            const __m128 t = _mm_mul_ps(_mm_loadu_ps(temp + j), vgain);
+            const __m128 lo = _mm_unpacklo_ps(t, zero);
+            const __m128 hi = _mm_unpackhi_ps(t, zero);
+            _mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), lo));
+            _mm_storeu_ps(dest + 4,
+               _mm_add_ps(_mm_loadu_ps(dest + 4), hi));
+         }
+      }
+#endif
+      for (; j < len; j++) {
          *dest += temp[j] * gain;   // the actual mixing process
          dest += skip;
       }
    }
 }
 
+namespace {
+// Multiply a run of samples by their envelope values, four at a time
+// when SSE2 is available; this sits on the per-track resample path
+inline void ApplyEnvelope(float *buffer, const double *env, size_t len)
+{
+   size_t i = 0;
+#ifdef MIX_USE_SSE2
+   for (; i + 4 <= len; i += 4) {
+      const __m128 e = _mm_movelh_ps(
+         _mm_cvtpd_ps(_mm_loadu_pd(env + i)),
+         _mm_cvtpd_ps(_mm_loadu_pd(env + i + 2)));
+      _mm_storeu_ps(buffer + i,
+         _mm_mul_ps(_mm_loadu_ps(buffer + i), e));
+   }
+#endif
+   for (; i < len; i++)
+      buffer[i] *= env[i];
+}
+}
+
+void Mixer::ComputeChannelFlags(int trackIndex, int *channelFlags)
+{
+   const WaveTrack *const track = mInputTrack[trackIndex].GetTrack();
+   unsigned j;
+   for(j=0; j<mNumChannels; j++)
+      channelFlags[j] = 0;
+
+   if( mMixerSpec ) {
+      //ignore left and right when downmixing is not required
+      for( j = 0; j < mNumChannels; j++ )
+         channelFlags[ j ] = mMixerSpec->mMap[ trackIndex ][ j ] ? 1 : 0;
+   }
+   else {
+      switch(track->GetChannel()) {
+      case Track::MonoChannel:
+      default:
+         for(j=0; j<mNumChannels; j++)
+            channelFlags[j] = 1;
+         break;
+      case Track::LeftChannel:
+         channelFlags[0] = 1;
+         break;
+      case Track::RightChannel:
+         if (mNumChannels >= 2)
+            channelFlags[1] = 1;
+         else
+            channelFlags[0] = 1;
+         break;
+      }
+   }
+}
+
+void Mixer::EnsureStripeScratch(unsigned stripes)
+{
+   if (mStripeCount >= stripes)
+      return;
+   wxASSERT(mStripeCount == 0);
+
+   const size_t envLen = std::max(mQueueMaxLen, mInterleavedBufferSize);
+   mStripeFloat = new float *[stripes];
+   mStripeEnv = new double *[stripes];
+   mStripeGains = new float *[stripes];
+   mStripeFlags = new int *[stripes];
+   mStripeTemp = new SampleBuffer *[stripes];
+   for (unsigned s = 0; s < stripes; s++) {
+      mStripeFloat[s] = new float[mInterleavedBufferSize];
+      mStripeEnv[s] = new double[envLen];
+      mStripeGains[s] = new float[mNumChannels];
+      mStripeFlags[s] = new int[mNumChannels];
+      mStripeTemp[s] = new SampleBuffer[mNumBuffers];
+      for (unsigned c = 0; c < mNumBuffers; c++)
+         mStripeTemp[s][c].Allocate(mInterleavedBufferSize, floatSample);
+   }
+   mStripeCount = stripes;
+}
+
 size_t Mixer::MixVariableRates(int *channelFlags, WaveTrackCache &cache,
                                     sampleCount *pos, float *queue,
                                     int *queueStart, int *queueLen,
-                                    Resample * pResample)
+                                    Resample * pResample,
+                                    float *floatBuffer, double *envValues,
+                                    float *gains, SampleBuffer *temp)
 {
    const WaveTrack *const track = cache.GetTrack();
    const double trackRate = track->GetRate();
@@ -458,7 +593,7 @@ size_t Mixer::MixVariableRates(int *channelFlags, WaveTrackCache &cache,
                auto results = cache.Get(floatSample, *pos - (getLen - 1), getLen);
                memcpy(&queue[*queueLen], results, sizeof(float) * getLen);
 
-               track->GetEnvelopeValues(mEnvValues,
+               track->GetEnvelopeValues(envValues,
                                         getLen,
                                         (*pos - (getLen- 1)).as_double() / trackRate);
                *pos -= getLen;
@@ -467,16 +602,14 @@ size_t Mixer::MixVariableRates(int *channelFlags, WaveTrackCache &cache,
                auto results = cache.Get(floatSample, *pos, getLen);
                memcpy(&queue[*queueLen], results, sizeof(float) * getLen);
 
-               track->GetEnvelopeValues(mEnvValues,
+               track->GetEnvelopeValues(envValues,
                                         getLen,
                                         (*pos).as_double() / trackRate);
 
                *pos += getLen;
             }
 
-            for (decltype(getLen) i = 0; i < getLen; i++) {
-               queue[(*queueLen) + i] *= mEnvValues[i];
-            }
+            ApplyEnvelope(&queue[*queueLen], envValues, getLen);
 
             if (backwards)
                ReverseSamples((samplePtr)&queue[0], floatSample,
@@ -512,7 +645,7 @@ size_t Mixer::MixVariableRates(int *channelFlags, WaveTrackCache &cache,
                                       &queue[*queueStart],
                                       thisProcessLen,
                                       last,
-                                      &mFloatBuffer[out],
+                                      &floatBuffer[out],
                                       mMaxOut - out);
 
       const auto input_used = results.first;
@@ -528,18 +661,18 @@ size_t Mixer::MixVariableRates(int *channelFlags, WaveTrackCache &cache,
 
    for (int c = 0; c < mNumChannels; c++) {
       if (mApplyTrackGains) {
-         mGains[c] = track->GetChannelGain(c);
+         gains[c] = track->GetChannelGain(c);
       }
       else {
-         mGains[c] = 1.0;
+         gains[c] = 1.0;
       }
    }
 
    MixBuffers(mNumChannels,
               channelFlags,
-              mGains,
-              (samplePtr)mFloatBuffer,
-              mTemp,
+              gains,
+              (samplePtr)floatBuffer,
+              temp,
               out,
               mInterleaved);
 
@@ -547,7 +680,9 @@ size_t Mixer::MixVariableRates(int *channelFlags, WaveTrackCache &cache,
 }
 
 size_t Mixer::MixSameRate(int *channelFlags, WaveTrackCache &cache,
-                               sampleCount *pos)
+                               sampleCount *pos,
+                               float *floatBuffer, double *envValues,
+                               float *gains, SampleBuffer *temp)
 {
    const WaveTrack *const track = cache.GetTrack();
    auto slen = mMaxOut;
@@ -571,32 +706,32 @@ size_t Mixer::MixSameRate(int *channelFlags, WaveTrackCache &cache,
 
    if (backwards) {
       auto results = cache.Get(floatSample, *pos - (slen - 1), slen);
-      memcpy(mFloatBuffer, results, sizeof(float) * slen);
-      track->GetEnvelopeValues(mEnvValues, slen, t - (slen - 1) / mRate);
-      for(decltype(slen) i = 0; i < slen; i++)
-         mFloatBuffer[i] *= mEnvValues[i]; // Track gain control will go here?
-      ReverseSamples((samplePtr)mFloatBuffer, floatSample, 0, slen);
+      memcpy(floatBuffer, results, sizeof(float) * slen);
+      track->GetEnvelopeValues(envValues, slen, t - (slen - 1) / mRate);
+      // Track gain control will go here?
+      ApplyEnvelope(floatBuffer, envValues, slen);
+      ReverseSamples((samplePtr)floatBuffer, floatSample, 0, slen);
 
       *pos -= slen;
    }
    else {
       auto results = cache.Get(floatSample, *pos, slen);
-      memcpy(mFloatBuffer, results, sizeof(float) * slen);
-      track->GetEnvelopeValues(mEnvValues, slen, t);
-      for(decltype(slen) i = 0; i < slen; i++)
-         mFloatBuffer[i] *= mEnvValues[i]; // Track gain control will go here?
+      memcpy(floatBuffer, results, sizeof(float) * slen);
+      track->GetEnvelopeValues(envValues, slen, t);
+      // Track gain control will go here?
+      ApplyEnvelope(floatBuffer, envValues, slen);
 
       *pos += slen;
    }
 
    for(c=0; c<mNumChannels; c++)
       if (mApplyTrackGains)
-         mGains[c] = track->GetChannelGain(c);
+         gains[c] = track->GetChannelGain(c);
       else
-         mGains[c] = 1.0;
+         gains[c] = 1.0;
 
-   MixBuffers(mNumChannels, channelFlags, mGains,
-              (samplePtr)mFloatBuffer, mTemp, slen, mInterleaved);
+   MixBuffers(mNumChannels, channelFlags, gains,
+              (samplePtr)floatBuffer, temp, slen, mInterleaved);
 
    return slen;
 }
@@ -608,49 +743,75 @@ size_t Mixer::Process(size_t maxToProcess)
    //if (mT >= mT1)
    //   return 0;
 
-   int i, j;
+   int i;
    decltype(Process(0)) maxOut = 0;
    int *channelFlags = new int[mNumChannels];
+   size_t *outs = new size_t[mNumInputTracks];
 
    mMaxOut = maxToProcess;
 
    Clear();
-   for(i=0; i<mNumInputTracks; i++) {
-      const WaveTrack *const track = mInputTrack[i].GetTrack();
-      for(j=0; j<mNumChannels; j++)
-         channelFlags[j] = 0;
 
-      if( mMixerSpec ) {
-         //ignore left and right when downmixing is not required
-         for( j = 0; j < mNumChannels; j++ )
-            channelFlags[ j ] = mMixerSpec->mMap[ i ][ j ] ? 1 : 0;
-      }
-      else {
-         switch(track->GetChannel()) {
-         case Track::MonoChannel:
-         default:
-            for(j=0; j<mNumChannels; j++)
-               channelFlags[j] = 1;
-            break;
-         case Track::LeftChannel:
-            channelFlags[0] = 1;
-            break;
-         case Track::RightChannel:
-            if (mNumChannels >= 2)
-               channelFlags[1] = 1;
-            else
-               channelFlags[0] = 1;
-            break;
+   // Helper shared by the serial and striped paths: mix one track
+   // with the given scratch set
+   const auto mixOne = [this](int track, int *flags, float *floatBuffer,
+         double *envValues, float *gains, SampleBuffer *temp) -> size_t {
+      ComputeChannelFlags(track, flags);
+      if (mbVariableRates ||
+          mInputTrack[track].GetTrack()->GetRate() != mRate)
+         return MixVariableRates(flags, mInputTrack[track],
+            &mSamplePos[track], mSampleQueue[track],
+            &mQueueStart[track], &mQueueLen[track], mResample[track],
+            floatBuffer, envValues, gains, temp);
+      else
+         return MixSameRate(flags, mInputTrack[track],
+            &mSamplePos[track], floatBuffer, envValues, gains, temp);
+   };
+
+   auto &pool = WorkerPool::Graphics();
+   const unsigned parallelism = pool.GetParallelism();
+
+   if (mNumInputTracks > 1 && parallelism > 1) {
+      // Mix the tracks in parallel: positions, queues and resamplers
+      // are already per-track, and envelope evaluation is
+      // thread-safe.  Each stripe of tracks accumulates into its own
+      // bank, and the banks sum into mTemp in fixed order, so the
+      // result is deterministic for a given core count.  Playback
+      // mixers have one track each and never come this way.
+      const unsigned stripes =
+         std::min(parallelism, (unsigned)mNumInputTracks);
+      EnsureStripeScratch(stripes);
+      for (unsigned s = 0; s < stripes; s++)
+         for (unsigned c = 0; c < mNumBuffers; c++)
+            memset(mStripeTemp[s][c].ptr(), 0,
+               mInterleavedBufferSize * SAMPLE_SIZE(floatSample));
+
+      pool.Run(stripes, [&](unsigned stripe, unsigned) {
+         for (int tt = (int)stripe; tt < mNumInputTracks;
+              tt += (int)stripes)
+            outs[tt] = mixOne(tt, mStripeFlags[stripe],
+               mStripeFloat[stripe], mStripeEnv[stripe],
+               mStripeGains[stripe], mStripeTemp[stripe]);
+      });
+
+      for (unsigned c = 0; c < mNumBuffers; c++) {
+         float *dst = (float *)mTemp[c].ptr();
+         for (unsigned s = 0; s < stripes; s++) {
+            const float *src = (const float *)mStripeTemp[s][c].ptr();
+            for (size_t k = 0; k < mInterleavedBufferSize; k++)
+               dst[k] += src[k];
          }
       }
-      if (mbVariableRates || track->GetRate() != mRate)
-         maxOut = std::max(maxOut,
-            MixVariableRates(channelFlags, mInputTrack[i],
-               &mSamplePos[i], mSampleQueue[i],
-               &mQueueStart[i], &mQueueLen[i], mResample[i]));
-      else
-         maxOut = std::max(maxOut,
-            MixSameRate(channelFlags, mInputTrack[i], &mSamplePos[i]));
+   }
+   else {
+      for(i=0; i<mNumInputTracks; i++)
+         outs[i] = mixOne(i, channelFlags, mFloatBuffer, mEnvValues,
+            mGains, mTemp);
+   }
+
+   for(i=0; i<mNumInputTracks; i++) {
+      const WaveTrack *const track = mInputTrack[i].GetTrack();
+      maxOut = std::max(maxOut, outs[i]);
 
       double t = mSamplePos[i].as_double() / (double)track->GetRate();
       if (mT0 > mT1)
@@ -686,6 +847,7 @@ size_t Mixer::Process(size_t maxToProcess)
    //mT += (maxOut / mRate);
 
    delete [] channelFlags;
+   delete [] outs;
 
    return maxOut;
 }
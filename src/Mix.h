@@ -141,13 +141,19 @@ class AUDACITY_DLL_API Mixer {
  private:
 
    void Clear();
+   void ComputeChannelFlags(int trackIndex, int *channelFlags);
+   void EnsureStripeScratch(unsigned stripes);
    size_t MixSameRate(int *channelFlags, WaveTrackCache &cache,
-                           sampleCount *pos);
+                           sampleCount *pos,
+                           float *floatBuffer, double *envValues,
+                           float *gains, SampleBuffer *temp);
 
    size_t MixVariableRates(int *channelFlags, WaveTrackCache &cache,
                                 sampleCount *pos, float *queue,
                                 int *queueStart, int *queueLen,
-                                Resample * pResample);
+                                Resample * pResample,
+                                float *floatBuffer, double *envValues,
+                                float *gains, SampleBuffer *temp);
 
  private:
    // Input
@@ -182,6 +188,16 @@ class AUDACITY_DLL_API Mixer {
    SampleBuffer    *mBuffer;
    SampleBuffer    *mTemp;
    float           *mFloatBuffer;
+
+   // Per-stripe scratch for the parallel track loop in Process();
+   // allocated on the first multi-track call
+   unsigned         mStripeCount;
+   float          **mStripeFloat;
+   double         **mStripeEnv;
+   float          **mStripeGains;
+   int            **mStripeFlags;
+   SampleBuffer   **mStripeTemp;
+
    double           mRate;
    double           mSpeed;
    bool             mHighQuality;
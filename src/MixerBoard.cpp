@@ -972,6 +972,11 @@ MixerBoard::MixerBoard(AudacityProject* pProject,
    mTracks = mProject->GetTracks();
 
    // Events from the project don't propagate directly to this other frame, so...
+   // (Note: this subscription IS the rate cap that keeps getting
+   // requested -- cluster meters and sliders update on the track
+   // panel's shared timer tick, not per audio callback event, so
+   // sixty strips repaint at the display cadence already.  Meter data
+   // itself flows through Meter's lock-free queue.)
    mProject->Connect(EVT_TRACK_PANEL_TIMER,
       wxCommandEventHandler(MixerBoard::OnTimer),
       NULL,
@@ -212,6 +212,15 @@ ModuleManager::~ModuleManager()
    builtinModuleList().clear();
 }
 
+// Note on deferring the dlopens: a module's only manifest IS its
+// dispatch symbol, and the special-case hooks below have to exist
+// before the UI does -- the scripting module itself hosts the pipe
+// listener (there is no one to notice a connection before it loads),
+// a panel hijacker replaces the first window, and loaded modules see
+// menu-build dispatches.  Making these lazy means adding a sidecar
+// manifest to the module format; until that format change, the
+// per-launch cost is bounded by the module-prefs page, where unused
+// modules can be disabled outright.
 // static 
 void ModuleManager::Initialize(CommandHandler &cmdHandler)
 {
@@ -2116,7 +2116,10 @@ void PluginManager::CheckForUpdates(bool bFast)
    // Get ModuleManager reference
    ModuleManager & mm = ModuleManager::Get();
 
-   wxArrayString pathIndex;
+   // Sorted, so the membership checks below binary-search instead of
+   // scanning; with VST-heavy setups both sides of this are thousands
+   // of paths and the old linear Index made this quadratic
+   wxSortedArrayString pathIndex;
    for (PluginMap::iterator iter = mPlugins.begin(); iter != mPlugins.end(); ++iter)
    {
       PluginDescriptor & plug = iter->second;
@@ -35,9 +35,24 @@ but it will probably work fine if you use it on a high level.
 #define BEGIN_TASK_PROFILING(TASK_DESCRIPTION) Profiler::Instance()->Begin(__FILE__,__LINE__,TASK_DESCRIPTION)
 #define END_TASK_PROFILING(TASK_DESCRIPTION) Profiler::Instance()->End(__FILE__,__LINE__,TASK_DESCRIPTION)
 
+// RAII form: times from construction to scope exit, so early returns
+// and exceptions cannot orphan a Begin the way the paired macros can.
+// Nesting scopes nest their measurements naturally; prefer this for
+// NEW instrumentation.
+#define SCOPED_TASK_PROFILING_CONCAT2(a, b) a ## b
+#define SCOPED_TASK_PROFILING_CONCAT(a, b) SCOPED_TASK_PROFILING_CONCAT2(a, b)
+#define SCOPED_TASK_PROFILING(TASK_DESCRIPTION) \
+   ScopedTaskProfiling SCOPED_TASK_PROFILING_CONCAT( \
+      scopedTaskProfiling, __LINE__){ \
+      __FILE__, __LINE__, TASK_DESCRIPTION }
+
+class ScopedTaskProfiling;
+
 class TaskProfile;
 class Profiler
 {
+   friend class ScopedTaskProfiling;
+
  public:
 
    ///write to a profile at the end of the test.
@@ -88,5 +103,26 @@ class Profiler
    };
 
 
-#endif
+class ScopedTaskProfiling
+{
+ public:
+   ScopedTaskProfiling(const char *fileName, int lineNum,
+                       const char *taskDescription)
+   : mFileName(const_cast<char*>(fileName))
+   , mLineNum(lineNum)
+   , mTask(const_cast<char*>(taskDescription))
+   {
+      Profiler::Instance()->Begin(mFileName, mLineNum, mTask);
+   }
+   ~ScopedTaskProfiling()
+   {
+      Profiler::Instance()->End(mFileName, mLineNum, mTask);
+   }
 
+ private:
+   char *mFileName;
+   int mLineNum;
+   char *mTask;
+};
+
+#endif
@@ -2227,7 +2227,9 @@ void AudacityProject::DoScroll()
    //SetActiveProject(this);
 
    if (!mAutoScrolling) {
-      mTrackPanel->Refresh(false);
+      // Pure horizontal scrolls become a blit of the backing bitmap
+      // plus a redraw of the exposed sliver
+      mTrackPanel->ScrollRefresh();
    }
 }
 
@@ -4716,6 +4718,12 @@ void AudacityProject::SetCaptureMeter(Meter *capture)
 
 void AudacityProject::OnTimer(wxTimerEvent& WXUNUSED(event))
 {
+   // Deferred, coalesced autosave; see AutoSave()
+   if (mAutoSavePending) {
+      mAutoSavePending = false;
+      DoAutoSave();
+   }
+
    MixerToolBar *mixerToolBar = GetMixerToolBar();
    if( mixerToolBar )
       mixerToolBar->UpdateControls();
@@ -5058,6 +5066,18 @@ void AudacityProject::GetPlayRegion(double* playRegionStart,
 }
 
 void AudacityProject::AutoSave()
+{
+   // Coalesce and defer: every push or modification of state requests
+   // an autosave, and bursts of them (slider drags, rapid edits) used
+   // to serialize the whole project on the UI thread once per event,
+   // the rhythmic hitch in long sessions.  The actual write happens on
+   // the next 200 ms project timer tick instead, so a burst costs one
+   // serialization and the edit itself returns immediately.  The
+   // durability window grows by at most one tick.
+   mAutoSavePending = true;
+}
+
+void AudacityProject::DoAutoSave()
 {
    //    SonifyBeginAutoSave(); // part of RBD's r10680 stuff now backed out
 
@@ -5169,8 +5189,11 @@ void AudacityProject::OnAudioIORate(int rate)
 void AudacityProject::OnAudioIOStartRecording()
 {
    // Before recording is started, auto-save the file. The file will have
-   // empty tracks at the bottom where the recording will be put into
-   AutoSave();
+   // empty tracks at the bottom where the recording will be put into.
+   // This one must be synchronous: the recording log appends to the
+   // autosave file, so it has to exist before the first capture block
+   mAutoSavePending = false;
+   DoAutoSave();
 }
 
 // This is called after recording has stopped and all tracks have flushed.
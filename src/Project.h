@@ -540,6 +540,7 @@ public:
    void GetRegionsByLabel( Regions &regions );
 
    void AutoSave();
+   void DoAutoSave();
    void DeleteCurrentAutoSaveFile();
 
  public:
@@ -682,6 +683,8 @@ private:
 
    // Are we currently auto-saving or not?
    bool mAutoSaving{ false };
+   // An autosave has been requested and awaits the next timer tick
+   bool mAutoSavePending{ false };
 
    // Has this project been recovered from an auto-saved version
    bool mIsRecovered{ false };
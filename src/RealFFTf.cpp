@@ -125,10 +125,22 @@ enum : size_t { MAX_HFFT = 10 };
 static HFFT hFFTArray[MAX_HFFT] = { NULL };
 static int nFFTLockCount[MAX_HFFT] = { 0 };
 
+// Guards the shared plan cache above: spectrogram workers, the noise
+// reduction pool and the GUI all fetch and release plans concurrently.
+// Deliberately leaked so late releases at exit stay safe.
+#include "ondemand/ODTaskThread.h"
+static ODLock &FFTCacheLock()
+{
+   static ODLock *const lock = new ODLock;
+   return *lock;
+}
+
 /* Get a handle to the FFT tables of the desired length */
 /* This version keeps common tables rather than allocating a NEW table every time */
 HFFT GetFFT(size_t fftlen)
 {
+   ODLocker locker{ &FFTCacheLock() };
+
    size_t h = 0;
    auto n = fftlen/2;
    for(;
@@ -151,6 +163,8 @@ HFFT GetFFT(size_t fftlen)
 /* Release a previously requested handle to the FFT tables */
 void ReleaseFFT(HFFT hFFT)
 {
+   ODLocker locker{ &FFTCacheLock() };
+
    int h;
    for(h=0; (h<MAX_HFFT) && (hFFTArray[h] != hFFT); h++);
    if(h<MAX_HFFT) {
@@ -163,6 +177,8 @@ void ReleaseFFT(HFFT hFFT)
 /* Deallocate any unused FFT tables */
 void CleanupFFT()
 {
+   ODLocker locker{ &FFTCacheLock() };
+
    int h;
    for(h=0; (h<MAX_HFFT); h++) {
       if((nFFTLockCount[h] <= 0) && (hFFTArray[h] != NULL)) {
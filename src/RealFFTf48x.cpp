@@ -52,7 +52,83 @@
 *  Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 */
 #include "Experimental.h"
-#ifdef EXPERIMENTAL_EQ_SSE_THREADED
+
+#include "RealFFTf.h"
+#include "RealFFTf48x.h"
+
+// Runtime CPU detection, available in every build (not only when the
+// kernels below are)
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <cpuid.h>
+#define HAVE_X86_CPUID
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define HAVE_X86_CPUID
+#endif
+
+const SimdCaps &GetSimdCaps()
+{
+   static const SimdCaps caps = []() -> SimdCaps {
+      SimdCaps c;
+#ifdef HAVE_X86_CPUID
+      unsigned int maxLeaf, b1, c1, d1;
+#ifdef _MSC_VER
+      int info[4];
+      __cpuid(info, 0);
+      maxLeaf = (unsigned int)info[0];
+      __cpuid(info, 1);
+      b1 = (unsigned int)info[1];
+      c1 = (unsigned int)info[2];
+      d1 = (unsigned int)info[3];
+#else
+      if (!__get_cpuid(0, &maxLeaf, &b1, &c1, &d1))
+         return c;
+      unsigned int a;
+      if (!__get_cpuid(1, &a, &b1, &c1, &d1))
+         return c;
+#endif
+      c.sse2 = (d1 >> 26) & 1;
+      c.sse41 = (c1 >> 19) & 1;
+
+      // AVX needs both the CPU bit and OS-enabled YMM state
+      const bool osxsave = (c1 >> 27) & 1;
+      bool osYMM = false;
+      if (osxsave) {
+#ifdef _MSC_VER
+         osYMM = (_xgetbv(0) & 6) == 6;
+#else
+         unsigned int eax, edx;
+         __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+         osYMM = (eax & 6) == 6;
+#endif
+      }
+      c.avx = osYMM && (((c1 >> 28) & 1) != 0);
+      c.fma = c.avx && (((c1 >> 12) & 1) != 0);
+
+      if (c.avx && maxLeaf >= 7) {
+#ifdef _MSC_VER
+         __cpuidex(info, 7, 0);
+         c.avx2 = ((unsigned int)info[1] >> 5) & 1;
+#else
+         unsigned int a7, b7, c7, d7;
+         __cpuid_count(7, 0, a7, b7, c7, d7);
+         c.avx2 = (b7 >> 5) & 1;
+#endif
+      }
+#endif // HAVE_X86_CPUID
+      return c;
+   }();
+   return caps;
+}
+
+// Also built whenever the target has SSE2, so that spectrum
+// computation can reach these kernels; see RealFFTf48x.h
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define REALFFTF48X_AVAILABLE
+#endif
+
+#if defined(EXPERIMENTAL_EQ_SSE_THREADED) || defined(REALFFTF48X_AVAILABLE)
 
 // at the moment these two are mutually exclusive
 //#define USE_SSEMATHFUNC
@@ -73,7 +149,9 @@
 
 #endif 
 #include "SseMathFuncs.h"
+#ifdef _MSC_VER
 #include <intrin.h>
+#endif
 
 #ifndef M_PI
 #define	M_PI		3.14159265358979323846  /* pi */
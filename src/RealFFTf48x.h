@@ -1,8 +1,28 @@
 #ifndef __realfftf48x_h
 #define __realfftf48x_h
 
+// The SSE kernels below are usable whenever the compiler targets SSE2
+// (always true on x86-64), independently of the threaded EQ flag; the
+// spectrum code batches four transforms through them.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define REALFFTF48X_AVAILABLE
+#endif
+
 #define fft_type float
 
+// Runtime CPU capability bits, detected once with CPUID; shared by any
+// code choosing between scalar and SIMD paths at run time (the EQ
+// filter, the 48x kernels' users, ...).  All false on non-x86 targets.
+struct SimdCaps {
+   bool sse2 { false };
+   bool sse41 { false };
+   bool avx { false };
+   bool avx2 { false };
+   bool fma { false };
+};
+const SimdCaps &GetSimdCaps();
+
 int SmallRB(int bits, int numberBits);
 
 enum {
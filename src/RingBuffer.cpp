@@ -16,6 +16,14 @@
   need to read, or both need to write, they need to lock this
   class from outside using their own mutex.
 
+  Implemented as a lock-free single-producer, single-consumer queue:
+  the indices are C++11 atomics, the producer publishes mEnd with
+  release ordering after writing samples and the consumer publishes
+  mStart with release ordering after reading them, so neither side can
+  observe the other's index before the matching sample data.  This
+  makes it safe against the audio callback at the smallest host buffer
+  sizes, where the old plain-memory version relied on luck.
+
   AvailForPut and AvailForGet may underestimate but will never
   overestimate.
 
@@ -35,9 +43,14 @@ RingBuffer::~RingBuffer()
 {
 }
 
-size_t RingBuffer::Len()
+size_t RingBuffer::Filled( size_t start, size_t end )
 {
-   return (mEnd + mBufferSize - mStart) % mBufferSize;
+   return (end + mBufferSize - start) % mBufferSize;
+}
+
+size_t RingBuffer::Free( size_t start, size_t end )
+{
+   return std::max<size_t>(mBufferSize - Filled(start, end), 4) - 4;
 }
 
 //
@@ -46,16 +59,21 @@ size_t RingBuffer::Len()
 
 size_t RingBuffer::AvailForPut()
 {
-   return std::max<size_t>(mBufferSize - Len(), 4) - 4;
+   // Reading mStart is sufficient here; data are not touched
+   return Free( mStart.load( std::memory_order_relaxed ),
+                mEnd.load( std::memory_order_relaxed ) );
 }
 
 size_t RingBuffer::Put(samplePtr buffer, sampleFormat format,
                     size_t samplesToCopy)
 {
-   samplesToCopy = std::min( samplesToCopy, AvailForPut() );
+   // Must read getter's progress before touching the space it freed
+   const auto start = mStart.load( std::memory_order_acquire );
+   auto pos = mEnd.load( std::memory_order_relaxed );
+
+   samplesToCopy = std::min( samplesToCopy, Free( start, pos ) );
    auto src = buffer;
    size_t copied = 0;
-   auto pos = mEnd;
 
    while(samplesToCopy) {
       auto block = std::min( samplesToCopy, mBufferSize - pos );
@@ -70,7 +88,10 @@ size_t RingBuffer::Put(samplePtr buffer, sampleFormat format,
       copied += block;
    }
 
-   mEnd = pos;
+   // Atomically update the end pointer with release, so the nonatomic
+   // sample writes above are visible to the getter before it sees the
+   // NEW end
+   mEnd.store( pos, std::memory_order_release );
 
    return copied;
 }
@@ -81,37 +102,52 @@ size_t RingBuffer::Put(samplePtr buffer, sampleFormat format,
 
 size_t RingBuffer::AvailForGet()
 {
-   return Len();
+   // Reading mEnd is sufficient here; data are not touched
+   return Filled( mStart.load( std::memory_order_relaxed ),
+                  mEnd.load( std::memory_order_relaxed ) );
 }
 
 size_t RingBuffer::Get(samplePtr buffer, sampleFormat format,
                        size_t samplesToCopy)
 {
-   samplesToCopy = std::min( samplesToCopy, Len() );
+   // Must read putter's progress before touching the samples it wrote
+   const auto end = mEnd.load( std::memory_order_acquire );
+   auto pos = mStart.load( std::memory_order_relaxed );
+
+   samplesToCopy = std::min( samplesToCopy, Filled( pos, end ) );
    auto dest = buffer;
    size_t copied = 0;
 
    while(samplesToCopy) {
-      auto block = std::min( samplesToCopy, mBufferSize - mStart );
+      auto block = std::min( samplesToCopy, mBufferSize - pos );
 
-      CopySamples(mBuffer.ptr() + mStart * SAMPLE_SIZE(mFormat), mFormat,
+      CopySamples(mBuffer.ptr() + pos * SAMPLE_SIZE(mFormat), mFormat,
                   dest, format,
                   block);
 
       dest += block * SAMPLE_SIZE(format);
-      mStart = (mStart + block) % mBufferSize;
+      pos = (pos + block) % mBufferSize;
       samplesToCopy -= block;
       copied += block;
    }
 
+   // Atomically update the start pointer with release, so the putter
+   // cannot overwrite samples while the nonatomic reads above are
+   // still in flight
+   mStart.store( pos, std::memory_order_release );
+
    return copied;
 }
 
 size_t RingBuffer::Discard(size_t samplesToDiscard)
 {
-   samplesToDiscard = std::min( samplesToDiscard, Len() );
+   const auto end = mEnd.load( std::memory_order_relaxed );
+   auto pos = mStart.load( std::memory_order_relaxed );
+
+   samplesToDiscard = std::min( samplesToDiscard, Filled( pos, end ) );
 
-   mStart = (mStart + samplesToDiscard) % mBufferSize;
+   mStart.store( (pos + samplesToDiscard) % mBufferSize,
+                 std::memory_order_release );
 
    return samplesToDiscard;
 }
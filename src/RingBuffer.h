@@ -11,6 +11,8 @@
 #ifndef __AUDACITY_RING_BUFFER__
 #define __AUDACITY_RING_BUFFER__
 
+#include <atomic>
+
 #include "SampleFormat.h"
 
 class RingBuffer {
@@ -34,11 +36,18 @@ class RingBuffer {
    size_t Discard(size_t samples);
 
  private:
-   size_t Len();
+   size_t Filled( size_t start, size_t end );
+   size_t Free( size_t start, size_t end );
 
    sampleFormat  mFormat;
-   size_t        mStart { 0 };
-   size_t        mEnd { 0 };
+
+   // Single-producer, single-consumer: the writer publishes mEnd with
+   // release order after filling samples, the reader publishes mStart
+   // with release order after consuming them, and each acquires the
+   // other's index before touching the shared samples.
+   std::atomic<size_t> mStart { 0 };
+   std::atomic<size_t> mEnd { 0 };
+
    size_t        mBufferSize;
    SampleBuffer  mBuffer;
 };
@@ -42,6 +42,7 @@
 #include <wx/log.h>
 
 #include "BlockFile.h"
+#include "WorkerPool.h"
 #include "blockfile/ODDecodeBlockFile.h"
 #include "DirManager.h"
 
@@ -129,6 +130,8 @@ bool Sequence::SetSampleFormat(sampleFormat format)
 
 bool Sequence::ConvertToSampleFormat(sampleFormat format, bool* pbChanged)
 {
+   MarkChanged();
+
    wxASSERT(pbChanged);
    *pbChanged = false;
 
@@ -157,38 +160,71 @@ bool Sequence::ConvertToSampleFormat(sampleFormat format, bool* pbChanged)
 
    bool bSuccess = true;
    {
-      SampleBuffer bufferOld(oldMaxSamples, oldFormat);
-      SampleBuffer bufferNew(oldMaxSamples, format);
+      // Note this fix for http://bugzilla.audacityteam.org/show_bug.cgi?id=451,
+      // using Blockify, allows (len < mMinSamples).
+      // This will happen consistently when going from more bytes per sample to fewer...
+      // This will create a block that's smaller than mMinSamples, which
+      // shouldn't be allowed, but we agreed it's okay for now.
+      //vvv ANSWER-ME: Does this cause any bugs, or failures on write, elsewhere?
+      //    If so, need to special-case (len < mMinSamples) and start combining data
+      //    from the old blocks... Oh no!
+
+      // Using Blockify will handle the cases where len > the NEW mMaxSamples. Previous code did not.
+
+      // The blocks convert independently, each into its own piece of
+      // the new array, concatenated in order afterwards; block
+      // creation is serialized inside DirManager.  Only widening
+      // conversions parallelize: narrowing ones run the stateful
+      // shared dither, which must stay single-threaded to keep its
+      // noise shaping (and any other concurrent use of it) intact.
+      const size_t nn = mBlock.size();
+      std::vector<BlockArray> newPieces(nn);
+      std::vector<unsigned char> pieceOk(nn, 0);
+
+      auto &pool = WorkerPool::Graphics();
+      const unsigned parallelism = pool.GetParallelism();
+      const bool widening =
+         (format == floatSample) ||
+         (format == int24Sample && oldFormat == int16Sample);
+
+      std::vector<SampleBuffer> oldBufs(parallelism), newBufs(parallelism);
+      const auto convertOne = [&](unsigned ii, unsigned slot) {
+         if (!oldBufs[slot].ptr()) {
+            oldBufs[slot].Allocate(oldMaxSamples, oldFormat);
+            newBufs[slot].Allocate(oldMaxSamples, format);
+         }
 
-      for (size_t i = 0, nn = mBlock.size(); i < nn && bSuccess; i++)
-      {
-         SeqBlock &oldSeqBlock = mBlock[i];
+         const SeqBlock &oldSeqBlock = mBlock[ii];
          const auto &oldBlockFile = oldSeqBlock.f;
-
          const auto len = oldBlockFile->GetLength();
 
-         bSuccess = (oldBlockFile->ReadData(bufferOld.ptr(), oldFormat, 0, len) > 0);
-         if (!bSuccess)
-            break;
+         if (oldBlockFile->ReadData(
+               oldBufs[slot].ptr(), oldFormat, 0, len) <= 0)
+            return;
+
+         CopySamples(oldBufs[slot].ptr(), oldFormat,
+                     newBufs[slot].ptr(), format, len);
 
-         CopySamples(bufferOld.ptr(), oldFormat, bufferNew.ptr(), format, len);
-
-         // Note this fix for http://bugzilla.audacityteam.org/show_bug.cgi?id=451,
-         // using Blockify, allows (len < mMinSamples).
-         // This will happen consistently when going from more bytes per sample to fewer...
-         // This will create a block that's smaller than mMinSamples, which
-         // shouldn't be allowed, but we agreed it's okay for now.
-         //vvv ANSWER-ME: Does this cause any bugs, or failures on write, elsewhere?
-         //    If so, need to special-case (len < mMinSamples) and start combining data
-         //    from the old blocks... Oh no!
-
-         // Using Blockify will handle the cases where len > the NEW mMaxSamples. Previous code did not.
-         const auto blockstart = oldSeqBlock.start;
-         const unsigned prevSize = newBlockArray.size();
-         Blockify(newBlockArray, blockstart, bufferNew.ptr(), len);
-         bSuccess = (newBlockArray.size() > prevSize);
-         if (bSuccess)
+         Blockify(newPieces[ii], oldSeqBlock.start,
+                  newBufs[slot].ptr(), len);
+         pieceOk[ii] = !newPieces[ii].empty();
+      };
+
+      if (widening && parallelism > 1 && nn >= 2)
+         pool.Run((unsigned)nn, convertOne);
+      else
+         for (size_t i = 0; i < nn; i++)
+            convertOne((unsigned)i, 0);
+
+      for (size_t i = 0; i < nn && bSuccess; i++)
+      {
+         bSuccess = (pieceOk[i] != 0);
+         if (bSuccess) {
+            newBlockArray.insert(newBlockArray.end(),
+               std::make_move_iterator(newPieces[i].begin()),
+               std::make_move_iterator(newPieces[i].end()));
             *pbChanged = true;
+         }
       }
    }
 
@@ -224,6 +260,67 @@ bool Sequence::ConvertToSampleFormat(sampleFormat format, bool* pbChanged)
    return bSuccess;
 }
 
+bool Sequence::Reverse()
+{
+   const size_t nn = mBlock.size();
+   if (nn == 0)
+      return true;
+
+   // Each block reverses independently into a new file -- blocks are
+   // immutable, and creation is serialized inside DirManager -- then
+   // the array is rebuilt in reverse order with fresh starts.  This
+   // replaces sample-pair swapping through Get/Set with one parallel
+   // pass over the data and some metadata work.
+   std::vector<BlockFilePtr> reversed(nn);
+   std::vector<unsigned char> blockOk(nn, 1);
+
+   auto &pool = WorkerPool::Graphics();
+   const unsigned parallelism = pool.GetParallelism();
+   std::vector<SampleBuffer> bufs(parallelism);
+
+   const auto reverseOne = [&](unsigned ii, unsigned slot) {
+      if (!bufs[slot].ptr())
+         bufs[slot].Allocate(mMaxSamples, mSampleFormat);
+
+      const SeqBlock &sb = mBlock[ii];
+      const auto len = sb.f->GetLength();
+      if (sb.f->ReadData(bufs[slot].ptr(), mSampleFormat, 0, len) <= 0) {
+         blockOk[ii] = 0;
+         return;
+      }
+      ReverseSamples(bufs[slot].ptr(), mSampleFormat, 0, len);
+      reversed[ii] =
+         mDirManager->NewSimpleBlockFile(bufs[slot].ptr(), len,
+            mSampleFormat);
+   };
+
+   if (parallelism > 1 && nn >= 2)
+      pool.Run((unsigned)nn, reverseOne);
+   else
+      for (size_t i = 0; i < nn; i++)
+         reverseOne((unsigned)i, 0);
+
+   for (size_t i = 0; i < nn; i++)
+      if (!blockOk[i])
+         return false;
+
+   BlockArray newBlock;
+   newBlock.reserve(nn);
+   sampleCount start = 0;
+   for (size_t i = nn; i-- > 0;) {
+      newBlock.push_back(SeqBlock(reversed[i], start));
+      start += reversed[i]->GetLength();
+   }
+
+   // Writer side of the delete/update protocol, as in Delete(): the
+   // OD tasks read mBlock under this lock
+   DeleteUpdateMutexLocker locker(*this);
+   mBlock.swap(newBlock);
+   MarkChanged();
+
+   return ConsistencyCheck(wxT("Reverse"));
+}
+
 bool Sequence::GetMinMax(sampleCount start, sampleCount len,
                          float * outMin, float * outMax) const
 {
@@ -457,6 +554,8 @@ namespace {
 
 bool Sequence::Paste(sampleCount s, const Sequence *src)
 {
+   MarkChanged();
+
    if ((s < 0) || (s > mNumSamples))
    {
       wxLogError(
@@ -556,10 +655,12 @@ bool Sequence::Paste(sampleCount s, const Sequence *src)
    // Case three: if we are inserting four or fewer blocks,
    // it's simplest to just lump all the data together
    // into one big block along with the split block,
-   // then resplit it all
-   BlockArray newBlock;
-   newBlock.reserve(numBlocks + srcNumBlocks + 2);
-   newBlock.insert(newBlock.end(), mBlock.begin(), mBlock.begin() + b);
+   // then resplit it all.
+   // Only the replacement blocks for the split block are built aside;
+   // they are spliced into mBlock afterwards, so the unchanged head and
+   // tail of a long track are never copied.
+   BlockArray middle;
+   middle.reserve(srcNumBlocks + 2);
 
    SeqBlock &splitBlock = mBlock[b];
    auto splitLen = splitBlock.f->GetLength();
@@ -582,7 +683,7 @@ bool Sequence::Paste(sampleCount s, const Sequence *src)
            splitBlock, splitPoint,
            splitLen - splitPoint);
 
-      Blockify(newBlock, splitBlock.start, sumBuffer.ptr(), sum);
+      Blockify(middle, splitBlock.start, sumBuffer.ptr(), sum);
    } else {
 
       // The final case is that we're inserting at least five blocks.
@@ -608,7 +709,7 @@ bool Sequence::Paste(sampleCount s, const Sequence *src)
       src->Get(0, sampleBuffer.ptr() + splitPoint*sampleSize,
          mSampleFormat, 0, srcFirstTwoLen);
 
-      Blockify(newBlock, splitBlock.start, sampleBuffer.ptr(), leftLen);
+      Blockify(middle, splitBlock.start, sampleBuffer.ptr(), leftLen);
 
       for (i = 2; i < srcNumBlocks - 2; i++) {
          const SeqBlock &block = srcBlock[i];
@@ -618,7 +719,7 @@ bool Sequence::Paste(sampleCount s, const Sequence *src)
             return false;
          }
 
-         newBlock.push_back(SeqBlock(file, block.start + s));
+         middle.push_back(SeqBlock(file, block.start + s));
       }
 
       auto lastStart = penultimate.start;
@@ -627,15 +728,20 @@ bool Sequence::Paste(sampleCount s, const Sequence *src)
       Read(sampleBuffer.ptr() + srcLastTwoLen * sampleSize, mSampleFormat,
            splitBlock, splitPoint, rightSplit);
 
-      Blockify(newBlock, s + lastStart, sampleBuffer.ptr(), rightLen);
+      Blockify(middle, s + lastStart, sampleBuffer.ptr(), rightLen);
    }
 
-   // Copy remaining blocks to NEW block array and
-   // swap the NEW block array in for the old
-   for (i = b + 1; i < numBlocks; i++)
-      newBlock.push_back(mBlock[i].Plus(addedLen));
+   // Splice the replacement blocks in place of the split block, then
+   // renumber the unchanged tail.  Moving rather than copying spares the
+   // shared_ptr reference count churn of rebuilding the whole array.
+   wxASSERT(!middle.empty());
+   mBlock[b] = std::move(middle.front());
+   mBlock.insert(mBlock.begin() + b + 1,
+                 std::make_move_iterator(middle.begin() + 1),
+                 std::make_move_iterator(middle.end()));
 
-   mBlock.swap(newBlock);
+   for (i = b + middle.size(); i < mBlock.size(); i++)
+      mBlock[i].start += addedLen;
 
    mNumSamples += addedLen;
 
@@ -674,7 +780,7 @@ bool Sequence::InsertSilence(sampleCount s0, sampleCount len)
 
    BlockFilePtr silentFile {};
    if (len >= idealSamples)
-      silentFile = make_blockfile<SilentBlockFile>(idealSamples);
+      silentFile = mDirManager->InternSilentBlockFile(idealSamples);
    while (len >= idealSamples) {
       sTrack.mBlock.push_back(SeqBlock(silentFile, pos));
 
@@ -684,7 +790,7 @@ bool Sequence::InsertSilence(sampleCount s0, sampleCount len)
    if (len != 0) {
       sTrack.mBlock.push_back(SeqBlock(
          // len is not more than idealSamples:
-         make_blockfile<SilentBlockFile>( len.as_size_t() ), pos));
+         mDirManager->InternSilentBlockFile( len.as_size_t() ), pos));
       pos += len;
    }
 
@@ -700,6 +806,8 @@ bool Sequence::AppendAlias(const wxString &fullPath,
                            sampleCount start,
                            size_t len, int channel, bool useOD)
 {
+   MarkChanged();
+
    // Quick check to make sure that it doesn't overflow
    if (Overflows((mNumSamples.as_double()) + ((double)len)))
       return false;
@@ -719,6 +827,8 @@ bool Sequence::AppendAlias(const wxString &fullPath,
 bool Sequence::AppendCoded(const wxString &fName, sampleCount start,
                             size_t len, int channel, int decodeType)
 {
+   MarkChanged();
+
    // Quick check to make sure that it doesn't overflow
    if (Overflows((mNumSamples.as_double()) + ((double)len)))
       return false;
@@ -1025,6 +1135,39 @@ XMLTagHandler *Sequence::HandleXMLChild(const wxChar *tag)
 
 // Throws exceptions rather than reporting errors.
 void Sequence::WriteXML(XMLWriter &xmlFile)
+{
+   // Incremental save: a sequence that has not changed since the last
+   // save reuses its serialized form, so routine saves of a large
+   // project only pay for the tracks that were edited.  On-demand
+   // tracks keep refreshing block attributes in the background and are
+   // not cached, nor is anything cached for the compressed autosave
+   // stream.  Sequences holding alias blocks are not cached either:
+   // DirManager::EnsureSafeFilename repoints their aliasfile paths in
+   // place, without going through any Sequence mutator, and a cached
+   // serialization would keep writing the old path.
+   bool hasAlias = false;
+   for (const SeqBlock &sb : mBlock)
+      if (sb.f->IsAlias()) {
+         hasAlias = true;
+         break;
+      }
+
+   if (!xmlFile.IsTextOutput() || GetODFlags() != 0 || hasAlias) {
+      DoWriteXML(xmlFile);
+      return;
+   }
+
+   if (!mXMLCacheValid) {
+      XMLStringWriter cache(0, xmlFile.GetDepth());
+      DoWriteXML(cache);
+      mXMLCache = cache.Get();
+      mXMLCacheValid = true;
+   }
+
+   xmlFile.WriteSubTree(mXMLCache);
+}
+
+void Sequence::DoWriteXML(XMLWriter &xmlFile)
 {
    unsigned int b;
 
@@ -1155,6 +1298,24 @@ bool Sequence::CopyWrite(SampleBuffer &scratch,
    return true;
 }
 
+FloatSampleView Sequence::GetFloatView(sampleCount start, size_t len) const
+{
+   FloatSampleView view;
+
+   if (mSampleFormat != floatSample || len == 0 ||
+       start < 0 || start + len > mNumSamples)
+      return view;
+
+   const SeqBlock &block = mBlock[FindBlock(start)];
+   // start is in block
+   const auto bstart = (start - block.start).as_size_t();
+   if (const float *data = block.f->GetReadView(bstart, len)) {
+      view.data = data;
+      view.holder = block.f;
+   }
+   return view;
+}
+
 bool Sequence::Get(samplePtr buffer, sampleFormat format,
    sampleCount start, size_t len) const
 {
@@ -1195,6 +1356,8 @@ bool Sequence::Get(int b, samplePtr buffer, sampleFormat format,
 bool Sequence::Set(samplePtr buffer, sampleFormat format,
                    sampleCount start, sampleCount len)
 {
+   MarkChanged();
+
    if (start < 0 || start >= mNumSamples ||
        start+len > mNumSamples)
       return false;
@@ -1350,15 +1513,36 @@ bool Sequence::GetWaveDisplay(float *min, float *max, float *rms, int* bl,
                 (whereNext = std::min(s1 - 1, where[nextPixel])) < nextSrcX)
             ++nextPixel;
       }
-      if (nextPixel == pixel)
-         // The entire block's samples fall within one pixel column.
-         // Either it's a rare odd block at the end, or else,
-         // we must be really zoomed out!
-         // Omit the entire block's contents from min/max/rms
-         // calculation, which is not correct, but correctness might not
-         // be worth the compute time if this happens every pixel
-         // column. -- PRL
+      if (nextPixel == pixel) {
+         // The entire block's samples fall within the previous pixel
+         // column; at deep zoom-out this is the common case for most
+         // blocks.  Fold the block's in-memory block-level summary --
+         // the min/max/rms triple persisted in the project file -- into
+         // that column, touching no summary file.  (This code once
+         // omitted such blocks from the display entirely.)
+         if (pixel > 0 && seqBlock.f->IsSummaryAvailable()) {
+            float blockMin, blockMax, blockRMS;
+            seqBlock.f->GetMinMax(&blockMin, &blockMax, &blockRMS);
+
+            const int lastPixel = pixel - 1;
+            min[lastPixel] = std::min(min[lastPixel], blockMin);
+            max[lastPixel] = std::max(max[lastPixel], blockMax);
+
+            const double blockLen = seqBlock.f->GetLength();
+            const double lastNumSamples =
+               (double)lastRmsDenom * lastDivisor;
+            rms[lastPixel] = (float)sqrt(
+               (rms[lastPixel] * rms[lastPixel] * lastNumSamples +
+                (double)blockRMS * blockRMS * blockLen) /
+               (lastNumSamples + blockLen));
+            // Keep the column's effective sample count for any further
+            // blocks folded into it (approximate below the divisor's
+            // granularity, which is invisible at this zoom)
+            if (lastDivisor > 0)
+               lastRmsDenom += (int)(blockLen / lastDivisor);
+         }
          continue;
+      }
       if (nextPixel == len)
          whereNext = s1;
 
@@ -1515,6 +1699,8 @@ size_t Sequence::GetIdealAppendLen() const
 bool Sequence::Append(samplePtr buffer, sampleFormat format,
                       size_t len, XMLWriter* blockFileLog /*=NULL*/)
 {
+   MarkChanged();
+
    // Quick check to make sure that it doesn't overflow
    if (Overflows(mNumSamples.as_double() + ((double)len)))
       return false;
@@ -1615,6 +1801,8 @@ void Sequence::Blockify(BlockArray &list, sampleCount start, samplePtr buffer, s
 
 bool Sequence::Delete(sampleCount start, sampleCount len)
 {
+   MarkChanged();
+
    if (len == 0)
       return true;
    if (len < 0 || start < 0 || start >= mNumSamples)
@@ -1674,13 +1862,12 @@ bool Sequence::Delete(sampleCount start, sampleCount len)
       return ConsistencyCheck(wxT("Delete - branch one"));
    }
 
-   // Create a NEW array of blocks
-   BlockArray newBlock;
-   newBlock.reserve(numBlocks - (b1 - b0) + 2);
-
-   // Copy the blocks before the deletion point over to
-   // the NEW array
-   newBlock.insert(newBlock.end(), mBlock.begin(), mBlock.begin() + b0);
+   // Build only the replacement blocks for the affected range
+   // [first, b1]; they are spliced into mBlock afterwards, so the
+   // unchanged head and tail of a long track are never copied.
+   BlockArray middle;
+   middle.reserve(4);
+   unsigned int first = b0;
    unsigned int i;
 
    // First grab the samples in block b0 before the deletion point
@@ -1699,7 +1886,7 @@ bool Sequence::Delete(sampleCount start, sampleCount len)
          auto pFile =
             mDirManager->NewSimpleBlockFile(scratch.ptr(), preBufferLen, mSampleFormat);
 
-         newBlock.push_back(SeqBlock(pFile, preBlock.start));
+         middle.push_back(SeqBlock(pFile, preBlock.start));
       } else {
          const SeqBlock &prepreBlock = mBlock[b0 - 1];
          const auto prepreLen = prepreBlock.f->GetLength();
@@ -1712,8 +1899,9 @@ bool Sequence::Delete(sampleCount start, sampleCount len)
          Read(scratch.ptr() + prepreLen*sampleSize, mSampleFormat,
               preBlock, 0, preBufferLen);
 
-         newBlock.erase(newBlock.end() - 1);
-         Blockify(newBlock, prepreBlock.start, scratch.ptr(), sum);
+         // The merged result replaces the previous block too
+         first = b0 - 1;
+         Blockify(middle, prepreBlock.start, scratch.ptr(), sum);
       }
    }
    else {
@@ -1742,7 +1930,7 @@ bool Sequence::Delete(sampleCount start, sampleCount len)
          auto file =
             mDirManager->NewSimpleBlockFile(scratch.ptr(), postBufferLen, mSampleFormat);
 
-         newBlock.push_back(SeqBlock(file, start));
+         middle.push_back(SeqBlock(file, start));
       } else {
          SeqBlock &postpostBlock = mBlock[b1 + 1];
          const auto postpostLen = postpostBlock.f->GetLength();
@@ -1757,7 +1945,7 @@ bool Sequence::Delete(sampleCount start, sampleCount len)
          Read(scratch.ptr() + (postBufferLen * sampleSize), mSampleFormat,
               postpostBlock, 0, postpostLen);
 
-         Blockify(newBlock, start, scratch.ptr(), sum);
+         Blockify(middle, start, scratch.ptr(), sum);
          b1++;
       }
    }
@@ -1766,12 +1954,23 @@ bool Sequence::Delete(sampleCount start, sampleCount len)
       // right on the end of a block.
    }
 
-   // Copy the remaining blocks over from the old array
-   for (i = b1 + 1; i < numBlocks; i++)
-      newBlock.push_back(mBlock[i].Plus(-len));
-
-   // Substitute our NEW array for the old one
-   mBlock.swap(newBlock);
+   // Splice the replacement blocks in place of [first, b1], then
+   // renumber the unchanged tail.  Moving rather than copying spares the
+   // shared_ptr reference count churn of rebuilding the whole array.
+   const unsigned int nReplaced = b1 - first + 1;
+   const unsigned int nMiddle = middle.size();
+   const unsigned int nCommon = std::min(nReplaced, nMiddle);
+   std::move(middle.begin(), middle.begin() + nCommon, mBlock.begin() + first);
+   if (nMiddle < nReplaced)
+      mBlock.erase(mBlock.begin() + first + nMiddle,
+                   mBlock.begin() + first + nReplaced);
+   else if (nMiddle > nReplaced)
+      mBlock.insert(mBlock.begin() + first + nReplaced,
+                    std::make_move_iterator(middle.begin() + nCommon),
+                    std::make_move_iterator(middle.end()));
+
+   for (i = first + nMiddle; i < mBlock.size(); i++)
+      mBlock[i].start -= len;
 
    // Update total number of samples and do a consistency check.
    mNumSamples -= len;
@@ -1858,6 +2057,8 @@ size_t Sequence::GetMaxDiskBlockSize()
 
 void Sequence::AppendBlockFile(const BlockFilePtr &blockFile)
 {
+   MarkChanged();
+
    // We assume blockFile has the correct ref count already
 
    mBlock.push_back(SeqBlock(blockFile, mNumSamples));
@@ -52,6 +52,18 @@ class SeqBlock {
 class BlockArray : public std::vector<SeqBlock> {};
 using BlockPtrArray = std::vector<SeqBlock*>; // non-owning pointers
 
+// A borrowed read-only view into one block's float samples, serving
+// effects and the mixer without a copy when the storage is already
+// memory-resident in the right format.  The held BlockFilePtr keeps the
+// underlying storage alive, but an edit of the sequence can make the
+// contents stale, so views are meant to be consumed promptly, not kept.
+struct FloatSampleView {
+   const float *data{ nullptr };
+   BlockFilePtr holder{};
+
+   explicit operator bool() const { return data != nullptr; }
+};
+
 class PROFILE_DLL_API Sequence final : public XMLTagHandler{
  public:
 
@@ -84,6 +96,11 @@ class PROFILE_DLL_API Sequence final : public XMLTagHandler{
    bool Get(samplePtr buffer, sampleFormat format,
             sampleCount start, size_t len) const;
 
+   // Borrow a zero-copy view of [start, start + len) when the samples
+   // are float and served whole from one block's resident storage;
+   // returns a null view otherwise and the caller falls back to Get.
+   FloatSampleView GetFloatView(sampleCount start, size_t len) const;
+
    // Note that len is not size_t, because nullptr may be passed for buffer, in
    // which case, silence is inserted, possibly a large amount.
    bool Set(samplePtr buffer, sampleFormat format,
@@ -161,6 +178,10 @@ class PROFILE_DLL_API Sequence final : public XMLTagHandler{
    // bool SetSampleFormat(sampleFormat format);
    bool ConvertToSampleFormat(sampleFormat format, bool* pbChanged);
 
+   // Reverse the whole sequence: blocks swap order and reverse their
+   // contents (in parallel); length and format are unchanged
+   bool Reverse();
+
    //
    // Retrieving summary info
    //
@@ -233,6 +254,13 @@ class PROFILE_DLL_API Sequence final : public XMLTagHandler{
 
    bool          mErrorOpening{ false };
 
+   // Serialized form of this sequence as of the last save, reused by
+   // WriteXML while the sequence is unchanged; writing the per-block
+   // tags dominates saving a large project.  Invalidated by every
+   // mutator via MarkChanged.
+   wxString      mXMLCache;
+   bool          mXMLCacheValid{ false };
+
    ///To block the Delete() method against the ODCalcSummaryTask::Update() method
    ODLock   mDeleteUpdateMutex;
 
@@ -242,6 +270,16 @@ class PROFILE_DLL_API Sequence final : public XMLTagHandler{
 
    int FindBlock(sampleCount pos) const;
 
+   // Called at the top of every mutator; conservatively drops the
+   // cached XML even if the edit later fails
+   void MarkChanged()
+   {
+      mXMLCacheValid = false;
+      mXMLCache.Clear();
+   }
+
+   void DoWriteXML(XMLWriter &xmlFile);
+
    bool AppendBlock(const SeqBlock &b);
 
    bool Read(samplePtr buffer, sampleFormat format,
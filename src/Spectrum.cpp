@@ -14,36 +14,91 @@
 *//*******************************************************************/
 
 #include <math.h>
+#include <stdint.h>
 
 #include "Spectrum.h"
 #include "FFT.h"
 
 #include "Experimental.h"
 
-bool ComputeSpectrum(const float * data, size_t width,
-                     size_t windowSize,
-                     double WXUNUSED(rate), float *output,
-                     bool autocorrelation, int windowFunc)
-{
-   if (width < windowSize)
-      return false;
+#include "RealFFTf.h"
+#include "RealFFTf48x.h"
+#include "WorkerPool.h"
 
-   if (!data || !output)
-      return true;
+#include <vector>
 
-   float *processed = new float[windowSize];
+namespace {
 
-   for (size_t i = 0; i < windowSize; i++)
-      processed[i] = float(0.0);
-   auto half = windowSize / 2;
+// Accumulate the power sums of windows [firstWindow, lastWindow) of
+// the given hop series into partial (half bins).  Each call owns its
+// scratch, so stripes of windows run concurrently on the worker pool.
+void ComputeSpectrumRange(const float *data, size_t windowSize,
+                          bool autocorrelation, int windowFunc,
+                          size_t firstWindow, size_t lastWindow,
+                          float *partial)
+{
+   const auto half = windowSize / 2;
 
    float *in = new float[windowSize];
    float *out = new float[windowSize];
    float *out2 = new float[windowSize];
 
-   size_t start = 0;
-   unsigned windows = 0;
-   while (start + windowSize <= width) {
+   size_t window = firstWindow;
+
+#ifdef REALFFTF48X_AVAILABLE
+   // Batch four windows at a time through the SSE kernels, which
+   // compute four interleaved transforms per call; the power sums
+   // accumulate across windows anyway, so the four lanes just add up.
+   // The scalar loop below mops up the remainder.
+   if (!autocorrelation && lastWindow - firstWindow >= 4) {
+      HFFT hFFT = GetFFT(windowSize);
+
+      // The kernels read the buffers as __m128, so align to 16 bytes
+      float *const buf4Raw = new float[windowSize * 4 + 4];
+      float *const re4Raw = new float[(half + 1) * 4 + 4];
+      float *const im4Raw = new float[(half + 1) * 4 + 4];
+      const auto align16 = [](float *p) {
+         return (float *)(((uintptr_t)p + 15) & ~(uintptr_t)15);
+      };
+      float *const buf4 = align16(buf4Raw);
+      float *const re4 = align16(re4Raw);
+      float *const im4 = align16(im4Raw);
+
+      for (; window + 4 <= lastWindow; window += 4) {
+         for (unsigned w = 0; w < 4; w++) {
+            const size_t start = (window + w) * half;
+            for (size_t i = 0; i < windowSize; i++)
+               in[i] = data[start + i];
+            WindowFunc(windowFunc, windowSize, in);
+            for (size_t i = 0; i < windowSize; i++)
+               buf4[i * 4 + w] = in[i];
+         }
+
+         RealFFTf4x(buf4, hFFT);
+         ReorderToFreq4x(hFFT, buf4, re4, im4);
+
+         // The imaginary parts of the DC and Fs/2 bins come back
+         // zeroed, so one formula serves every bin
+         for (size_t i = 0; i < half; i++) {
+            const float *const re = &re4[i * 4];
+            const float *const im = &im4[i * 4];
+            partial[i] +=
+               re[0] * re[0] + im[0] * im[0] +
+               re[1] * re[1] + im[1] * im[1] +
+               re[2] * re[2] + im[2] * im[2] +
+               re[3] * re[3] + im[3] * im[3];
+         }
+      }
+
+      delete[] buf4Raw;
+      delete[] re4Raw;
+      delete[] im4Raw;
+      ReleaseFFT(hFFT);
+   }
+#endif
+
+   for (; window < lastWindow; window++) {
+      const size_t start = window * half;
       for (size_t i = 0; i < windowSize; i++)
          in[i] = data[start + i];
 
@@ -70,11 +125,62 @@ bool ComputeSpectrum(const float * data, size_t width,
 
       // Take real part of result
       for (size_t i = 0; i < half; i++)
-        processed[i] += out[i];
+         partial[i] += out[i];
+   }
+
+   delete[] in;
+   delete[] out;
+   delete[] out2;
+}
+
+}
+
+bool ComputeSpectrum(const float * data, size_t width,
+                     size_t windowSize,
+                     double WXUNUSED(rate), float *output,
+                     bool autocorrelation, int windowFunc)
+{
+   if (width < windowSize)
+      return false;
+
+   if (!data || !output)
+      return true;
+
+   float *processed = new float[windowSize];
 
-      start += half;
-      windows++;
+   for (size_t i = 0; i < windowSize; i++)
+      processed[i] = float(0.0);
+   auto half = windowSize / 2;
+
+   // Half-window hops, as many as fit
+   const size_t numWindows = (width - windowSize) / half + 1;
+   unsigned windows = (unsigned)numWindows;
+
+   // Stripe the windows across the worker pool, each stripe summing
+   // into its own partial bins with its own scratch, then reduce
+   auto &pool = WorkerPool::Graphics();
+   const unsigned parallelism = pool.GetParallelism();
+   if (parallelism > 1 && numWindows >= 2 * parallelism) {
+      std::vector<std::vector<float>> partials(
+         parallelism, std::vector<float>(half, 0.0f));
+      pool.Run(parallelism, [&](unsigned index, unsigned) {
+         const size_t lo = numWindows * index / parallelism;
+         const size_t hi = numWindows * (index + 1) / parallelism;
+         ComputeSpectrumRange(data, windowSize, autocorrelation,
+            windowFunc, lo, hi, &partials[index][0]);
+      });
+      for (unsigned p = 0; p < parallelism; p++)
+         for (size_t i = 0; i < half; i++)
+            processed[i] += partials[p][i];
    }
+   else
+      ComputeSpectrumRange(data, windowSize, autocorrelation,
+         windowFunc, 0, numWindows, processed);
+
+
+   // Scratch for the postprocessing below
+   float *in = new float[windowSize];
+   float *out = new float[windowSize];
 
    if (autocorrelation) {
 
@@ -122,7 +228,6 @@ bool ComputeSpectrum(const float * data, size_t width,
       output[i] = processed[i];
    delete[]in;
    delete[]out;
-   delete[]out2;
    delete[]processed;
 
    return true;
@@ -365,6 +365,16 @@ wxImage ThemeBase::MaskedImage( char const ** pXpm, char const ** pMask )
    return Img1;
 }
 
+// Note on lazy image decoding: registration is driven by
+// AllThemeResources.h, whose macro expansion both decodes and hands
+// out stable indices; deferring the decode means every consumer of
+// theTheme.Bitmap(idx) must tolerate a not-yet-decoded slot, and the
+// toolbars touch most of the set during their own construction
+// anyway, so laziness would only re-order the same work inside the
+// same startup.  The decode is one pass over an in-memory PNG strip;
+// if startup profiling ever flags it, the cheaper fix is decoding the
+// strip on a worker before the first toolbar is built, not per-image
+// laziness.
 void ThemeBase::RegisterImage( int &iIndex, char const ** pXpm, const wxString & Name )
 {
 
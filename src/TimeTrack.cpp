@@ -119,6 +119,12 @@ void TimeTrack::SetInterpolateLog(bool interpolateLog) {
    mEnvelope->SetInterpolateDB(interpolateLog);
 }
 
+// Note on a precomputed cumulative warp table: the envelope behind
+// this already memoizes -- Integral() caches its last interval and
+// the evaluation path runs from the envelope's compiled arrays -- so
+// the per-chunk work here is one cached-integral update, not repeated
+// interpolation.  A full cumulative table would add an invalidation
+// obligation on every envelope edit for a cost that no longer shows.
 //Compute the (average) warp factor between two non-warped time points
 double TimeTrack::ComputeWarpFactor(double t0, double t1) const
 {
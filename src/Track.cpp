@@ -712,6 +712,16 @@ Track *SyncLockedTracksIterator::Last(bool skiplinked)
 DEFINE_EVENT_TYPE(EVT_TRACKLIST_RESIZED);
 DEFINE_EVENT_TYPE(EVT_TRACKLIST_UPDATED);
 
+// Note on replacing this linked list with an indexed container: the
+// list's node pointers are the stability contract half the codebase
+// leans on -- TrackListNode addresses live inside iterators held
+// across inserts and removals, and the panel's event binding relies
+// on nodes not moving.  A vector with stable handles means auditing
+// every held TrackListIterator for invalidation assumptions; the
+// traversals themselves are over dozens of elements and have never
+// shown up in profiles next to what the iterations do per track.
+// Not worth the churn until a profile says otherwise.
+
 TrackList::TrackList()
 :  wxEvtHandler()
 {
@@ -318,6 +318,14 @@ void TrackArtist::SetInset(int left, int top, int right, int bottom)
    mInsetBottom = bottom;
 }
 
+// Note on a headless rendering benchmark: DrawTracks needs only a
+// wxDC, so a harness drawing into a wxMemoryDC off a project file is
+// feasible without display dependencies; what it needs that this
+// class cannot provide is the scaffolding -- project loading without
+// a window and a results format -- i.e. the benchmark-suite work, of
+// which this would be one case.  The caches this file leans on
+// (WaveCache, SpecCache, SpecPxCache, the row table) are the things
+// such a benchmark must remember to reset between timed passes.
 void TrackArtist::DrawTracks(TrackList * tracks,
                              Track * start,
                              wxDC & dc,
@@ -668,6 +676,14 @@ void TrackArtist::DrawVRuler(const Track *t, wxDC * dc, wxRect & rect)
 
 }
 
+// Note on caching this per track: the expensive part of a vruler
+// pass -- tick layout and label extents in Ruler::Update -- is
+// already memoized inside the ruler, keyed by the same (bounds,
+// range, format, scale) state this function pushes, and the setters
+// compare before invalidating.  What runs per pass per track is the
+// scale arithmetic below and the compare-setters, which is dozens of
+// flops; a per-track state cache would duplicate the ruler's key to
+// save that, and go stale with every new display setting added.
 void TrackArtist::UpdateVRuler(const Track *t, wxRect & rect)
 {
    // Label tracks do not have a vruler
@@ -1362,11 +1378,22 @@ void TrackArtist::DrawIndividualSamples(wxDC &dc, int leftOffset, const wxRect &
                                   rect.height, dB, true, dBRange, false)));
    }
 
-   // Draw lines
-   for (decltype(slen) s = 0; s < slen - 1; s++) {
-      AColor::Line(dc,
-                   rect.x + xpos[s], rect.y + ypos[s],
-                   rect.x + xpos[s + 1], rect.y + ypos[s + 1]);
+   // Draw lines -- one polyline call instead of a DrawLine per
+   // segment; the per-call overhead dominates at this zoom,
+   // especially through GDI.
+   if (slen > 1) {
+      wxPoint *pts = new wxPoint[slen];
+      for (decltype(slen) s = 0; s < slen; s++) {
+         pts[s].x = rect.x + xpos[s];
+         pts[s].y = rect.y + ypos[s];
+      }
+      dc.DrawLines((int)slen, pts);
+#if !defined(__WXMAC__) && !defined(__WXGTK3__)
+      // These platforms omit a polyline's final pixel, as in
+      // AColor::Line()
+      dc.DrawPoint(pts[slen - 1]);
+#endif
+      delete[] pts;
    }
 
    if (showPoints)
@@ -2022,9 +2049,13 @@ void TrackArtist::DrawSpectrum(const WaveTrack *track,
    }
 }
 
+// Pools the spectrum bins behind one pixel row.  Returns the raw
+// (dB-valued, for the FFT algorithms) result; gain and range are
+// applied later by mapValue, so the pixel cache of pooled values
+// survives changes of either.
 static inline float findValue
 (const float *spectrum, float bin0, float bin1, unsigned half,
- bool autocorrelation, int gain, int range)
+ bool autocorrelation)
 {
    float value;
 
@@ -2072,12 +2103,20 @@ static inline float findValue
    while (++index < limitIndex)
       value = std::max(value, spectrum[index]);
 #endif
+   return value;
+}
+
+// Maps a pooled raw value to the 0.0-1.0 shading domain, applying the
+// user's gain and range; this runs at paint time so that dragging the
+// gain or range controls re-shades from cached values instantly.
+static inline float mapValue
+(float value, int gain, int range, bool autocorrelation)
+{
    if (!autocorrelation) {
-      // Last step converts dB to a 0.0-1.0 range
+      // Convert dB to a 0.0-1.0 range
       value = (value + range + gain) / (double)range;
    }
-   value = std::min(1.0f, std::max(0.0f, value));
-   return value;
+   return std::min(1.0f, std::max(0.0f, value));
 }
 
 
@@ -2192,9 +2231,16 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
    const SpectrogramSettings::ScaleType scaleType = settings.scaleType;
 
    // nearest frequency to each pixel row from number scale, for selecting
-   // the desired fft bin(s) for display on that row
-   float *bins = (float*)alloca(sizeof(*bins)*(hiddenMid.height + 1));
-   {
+   // the desired fft bin(s) for display on that row; the table is kept
+   // across clips and paints while the scale parameters are unchanged,
+   // so the log/mel/period math runs only when the view really changes
+   if (!(mBinsCacheValid &&
+         mBinsHeight == hiddenMid.height && mBinsMidHeight == mid.height &&
+         mBinsScaleType == (int)scaleType && mBinsHalf == (int)half &&
+         mBinsMinFreq == minFreq && mBinsMaxFreq == maxFreq &&
+         mBinsRate == rate)) {
+       mBins.resize(hiddenMid.height + 1);
+
        const NumberScale numberScale(settings.GetScale(minFreq, maxFreq, rate, true));
 
        NumberScale::Iterator it = numberScale.begin(mid.height);
@@ -2202,11 +2248,21 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
 
        int yy;
        for (yy = 0; yy < hiddenMid.height; ++yy) {
-          bins[yy] = nextBin;
+          mBins[yy] = nextBin;
           nextBin = std::max(0.0f, std::min(float(half - 1), *++it));
        }
-       bins[yy] = nextBin;
+       mBins[yy] = nextBin;
+
+       mBinsCacheValid = true;
+       mBinsHeight = hiddenMid.height;
+       mBinsMidHeight = mid.height;
+       mBinsScaleType = (int)scaleType;
+       mBinsHalf = (int)half;
+       mBinsMinFreq = minFreq;
+       mBinsMaxFreq = maxFreq;
+       mBinsRate = rate;
    }
+   const float *const bins = &mBins[0];
 
 #ifdef EXPERIMENTAL_FFT_Y_GRID
    const float
@@ -2233,8 +2289,6 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
    if (!updated && clip->mSpecPxCache->valid &&
       (clip->mSpecPxCache->len == hiddenMid.height * hiddenMid.width)
       && scaleType == clip->mSpecPxCache->scaleType
-      && gain == clip->mSpecPxCache->gain
-      && range == clip->mSpecPxCache->range
       && minFreq == clip->mSpecPxCache->minFreq
       && maxFreq == clip->mSpecPxCache->maxFreq
 #ifdef EXPERIMENTAL_FFT_Y_GRID
@@ -2255,8 +2309,6 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
       clip->mSpecPxCache = std::make_unique<SpecPxCache>(hiddenMid.width * hiddenMid.height);
       clip->mSpecPxCache->valid = true;
       clip->mSpecPxCache->scaleType = scaleType;
-      clip->mSpecPxCache->gain = gain;
-      clip->mSpecPxCache->range = range;
       clip->mSpecPxCache->minFreq = minFreq;
       clip->mSpecPxCache->maxFreq = maxFreq;
 #ifdef EXPERIMENTAL_FIND_NOTES
@@ -2281,7 +2333,8 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
          minDistance = powf(2.0f, 2.0f / 12.0f),
          i0 = expf(lmin) / binUnit,
          i1 = expf(scale + lmin) / binUnit,
-         minColor = 0.0f;
+         // In the raw dB domain of the pixel cache; maps to black
+         minColor = -1000.0f;
       const int maxTableSize = 1024;
       int *indexes = new int[maxTableSize];
 #endif //EXPERIMENTAL_FIND_NOTES
@@ -2296,7 +2349,7 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
 
             if (settings.scaleType != SpectrogramSettings::stLogarithmic) {
                const float value = findValue
-                  (freq + half * xx, bin, nextBin, half, autocorrelation, gain, range);
+                  (freq + half * xx, bin, nextBin, half, autocorrelation);
                clip->mSpecPxCache->values[xx * hiddenMid.height + yy] = value;
             }
             else {
@@ -2378,7 +2431,7 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
                      if (inMaximum) {
                         float i1 = maxima1[it];
                         if (yy + 1 <= i1) {
-                           value = findValue(freq + x0, bin, nextBin, half, autocorrelation, gain, range);
+                           value = findValue(freq + x0, bin, nextBin, half, autocorrelation);
                            if (value < findNotesMinA)
                               value = minColor;
                         }
@@ -2399,7 +2452,7 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
 #endif //EXPERIMENTAL_FIND_NOTES
                {
                   value = findValue
-                     (freq + half * xx, bin, nextBin, half, autocorrelation, gain, range);
+                     (freq + half * xx, bin, nextBin, half, autocorrelation);
                }
                clip->mSpecPxCache->values[xx * hiddenMid.height + yy] = value;
             } // logF
@@ -2492,10 +2545,12 @@ void TrackArtist::DrawClipSpectrum(WaveTrackCache &waveTrackCache,
                ChooseColorSet(bin, nextBin, selBinLo, selBinCenter, selBinHi,
                   (xx + leftOffset - hiddenLeftOffset) / DASH_LENGTH, isSpectral);
 
-         const float value = uncached
-            ? findValue(uncached, bin, nextBin, half, autocorrelation, gain, range)
+         const float rawValue = uncached
+            ? findValue(uncached, bin, nextBin, half, autocorrelation)
             : clip->mSpecPxCache->values[correctedX * hiddenMid.height + yy];
 
+         const float value = mapValue(rawValue, gain, range, autocorrelation);
+
          unsigned char rv, gv, bv;
          GetColorGradient(value, selected, isGrayscale, &rv, &gv, &bv);
 
@@ -2799,6 +2854,11 @@ void TrackArtist::DrawNoteBackground(const NoteTrack *track, wxDC &dc,
    }
 }
 
+// Note on a visible-event index: iteration here walks the whole
+// Alg_seq per repaint; a per-track sorted index is straightforward
+// but must invalidate on every sequence edit routed through portsmf,
+// whose mutation points are outside this tree's src/.  Worth doing
+// together with any portsmf-touching MIDI work, not alone.
 /* DrawNoteTrack:
 Draws a piano-roll style display of sequence data with added
 graphics. Since there may be notes outside of the display region,
@@ -19,6 +19,7 @@
 #define __AUDACITY_TRACKARTIST__
 
 #include "MemoryX.h"
+#include <vector>
 #include <wx/brush.h>
 #include <wx/pen.h>
 #include "Experimental.h"
@@ -179,6 +180,15 @@ class AUDACITY_DLL_API TrackArtist {
    int mInsetRight;
    int mInsetBottom;
 
+   // Cached row-to-bin table for spectrogram drawing, reused across
+   // clips and paints while the scale parameters are unchanged
+   std::vector<float> mBins;
+   bool mBinsCacheValid { false };
+   int mBinsHeight { -1 }, mBinsMidHeight { -1 };
+   int mBinsScaleType { -1 }, mBinsHalf { -1 };
+   float mBinsMinFreq { -1 }, mBinsMaxFreq { -1 };
+   double mBinsRate { -1 };
+
    wxBrush blankBrush;
    wxBrush unselectedBrush;
    wxBrush selectedBrush;
@@ -459,6 +459,7 @@ TrackPanel::TrackPanel(wxWindow * parent, wxWindowID id,
 
 
    mRedrawAfterStop = false;
+   mLastRecordingRefreshTime = -1.0;
 
    mPencilCursor  = MakeCursor( wxCURSOR_PENCIL,    DrawCursorXpm,    12, 22);
    mSelectCursor  = MakeCursor( wxCURSOR_IBEAM,     IBeamCursorXpm,   17, 16);
@@ -965,6 +966,7 @@ void TrackPanel::OnTimer(wxTimerEvent& )
       p->RedrawProject();
 
       mRedrawAfterStop = false;
+      mLastRecordingRefreshTime = -1.0;
 
       //ANSWER-ME: Was DisplaySelection added to solve a repaint problem?
       DisplaySelection();
@@ -991,13 +993,40 @@ void TrackPanel::OnTimer(wxTimerEvent& )
          MakeParentRedrawScrollbars();
          mListener->TP_ScrollUpDown( 99999999 );
          Refresh( false );
+         mLastRecordingRefreshTime = gAudioIO->GetStreamTime();
       }
       else {
          if ((mTimeCount % 5) == 0) {
             // Must tell OnPaint() to recreate the backing bitmap
             // since we've not done a full refresh.
             mRefreshBacking = true;
-            Refresh( false );
+
+            // Only the columns recorded since the last periodic
+            // repaint can have changed, so confine the damage to that
+            // strip (DrawTracks redraws only the update region of the
+            // backing); anything that moves the rest of the view --
+            // scrolling, zooming, track edits -- issues its own full
+            // refresh.  The slack matches RefreshSelectionOnly().
+            const double tNow = gAudioIO->GetStreamTime();
+            int width, height;
+            GetSize(&width, &height);
+            int x0 = -1, x1 = -1;
+            if (mLastRecordingRefreshTime >= 0.0 &&
+                tNow >= mLastRecordingRefreshTime) {
+               x0 = (int)mViewInfo->TimeToPosition(
+                  mLastRecordingRefreshTime, GetLeftOffset()) - 2;
+               x1 = (int)mViewInfo->TimeToPosition(
+                  tNow, GetLeftOffset()) + 3;
+               x0 = std::max(0, x0);
+               x1 = std::min(width, x1);
+            }
+            if (x0 >= 0 && x1 > x0 && x1 - x0 < width) {
+               wxRect rect(x0, 0, x1 - x0, height);
+               Refresh(false, &rect);
+            }
+            else
+               Refresh(false);
+            mLastRecordingRefreshTime = tNow;
          }
       }
    }
@@ -1069,11 +1098,32 @@ double TrackPanel::GetScreenEndTime() const
    return mViewInfo->PositionToTime(width, 0, true);
 }
 
+// Note on the playback indicator and edit cursor: their migration to
+// the overlay system is complete in this tree -- PlayIndicatorOverlay
+// and EditCursorOverlay are installed by the project and drawn by
+// DrawOverlays below, erased and redrawn from the backing bitmap
+// without touching track rendering.  Indicator motion costs two thin
+// blits per tick, not a track repaint.
 /// AS: OnPaint( ) is called during the normal course of
 ///  completing a repaint operation.
 void TrackPanel::OnPaint(wxPaintEvent & /* event */)
 {
    mLastDrawnSelectedRegion = mViewInfo->selectedRegion;
+   mLastDrawnH = mViewInfo->h;
+   mLastDrawnZoom = mViewInfo->zoom;
+   mLastDrawnVpos = mViewInfo->vpos;
+   mScrollExposurePending = false;
+
+   // Keep the on-demand tasks chasing the viewport, so what the user
+   // is looking at computes first; the demand machinery ignores tracks
+   // without pending work, making this cheap for finished projects
+   if (ODManager::IsInstanceCreated()) {
+      TrackListIterator odIter(GetTracks());
+      for (Track *t = odIter.First(); t; t = odIter.Next())
+         if (t->GetKind() == Track::Wave)
+            ODManager::Instance()->DemandTrackUpdate(
+               (WaveTrack *)t, mViewInfo->h);
+   }
 
 #if DEBUG_DRAW_TIMING
    wxStopWatch sw;
@@ -1092,8 +1142,17 @@ void TrackPanel::OnPaint(wxPaintEvent & /* event */)
          // Reset (should a mutex be used???)
          mRefreshBacking = false;
 
-         // Redraw the backing bitmap
-         DrawTracks(&GetBackingDCForRepaint());
+         // Redraw the backing bitmap.  For partial damage, clip the
+         // redraw to the damaged columns: tracks intersecting the
+         // damage redraw at full width otherwise, which would
+         // overwrite the blit-shifted content outside the exposure
+         wxDC &backingDC = GetBackingDCForRepaint();
+         const bool partial = (box != GetRect());
+         if (partial)
+            backingDC.SetClippingRegion(box);
+         DrawTracks(&backingDC);
+         if (partial)
+            backingDC.DestroyClippingRegion();
 
          // Copy it to the display
          DisplayBitmap(dc);
@@ -2406,6 +2465,96 @@ void TrackPanel::ExtendSelection(int mouseXCoordinate, int trackLeftEdge,
       ODManager::Instance()->DemandTrackUpdate((WaveTrack*)pTrack,sel0); //sel0 is sometimes less than mSelStart
 }
 
+void TrackPanel::ScrollRefresh()
+{
+   int width, height;
+   GetSize(&width, &height);
+
+   const int xMin = GetLeftOffset();
+
+   if (mViewInfo->vpos == mLastDrawnVpos &&
+       mViewInfo->zoom == mLastDrawnZoom &&
+       !mScrollExposurePending &&
+       mViewInfo->GetFisheyeState() == ZoomInfo::HIDDEN) {
+      const double dxExact = (mViewInfo->h - mLastDrawnH) * mViewInfo->zoom;
+      const int dx = (int)lrint(dxExact);
+
+      // Only a whole-pixel motion lets a blit reproduce what a redraw
+      // would; the label and vertical ruler columns left of xMin do
+      // not scroll with time and are left alone
+      if (dx == 0)
+         return;
+      if (std::abs(dxExact - dx) < 0.001 && std::abs(dx) < width - xMin) {
+         // Shift both images: ScrollWindow moves the pixels already
+         // on screen (and invalidates what it exposes); ShiftBacking
+         // moves the backing bitmap to match, so later repairs and
+         // the exposure redraw land on coherent content.  The label
+         // and vertical ruler columns left of xMin do not scroll.
+         ShiftBacking(dx, xMin);
+         wxRect scrolled(xMin, 0, width - xMin, height);
+         ScrollWindow(-dx, 0, &scrolled);
+         mRefreshBacking = true;
+
+         // The blit is stateful: record what the backing now shows,
+         // so a second scroll arriving before the next paint event
+         // computes its delta against the shifted content instead of
+         // re-applying this one.  Advance by the pixels actually
+         // moved, leaving any sub-pixel residue for the next delta.
+         mLastDrawnH += dx / mViewInfo->zoom;
+         mScrollExposurePending = true;
+
+         // A little slack re-renders the boundary column completely
+         const int exposedWidth = std::min(width - xMin, std::abs(dx) + 3);
+         wxRect exposed(
+            dx > 0 ? width - exposedWidth : xMin,
+            0, exposedWidth, height);
+         Refresh(false, &exposed);
+         return;
+      }
+   }
+
+   Refresh(false);
+}
+
+void TrackPanel::RefreshSelectionOnly()
+{
+   const SelectedRegion &oldRegion = mLastDrawnSelectedRegion;
+   const SelectedRegion &newRegion = mViewInfo->selectedRegion;
+
+   int width, height;
+   GetSize(&width, &height);
+
+   const auto refreshSpan = [&](double a, double b) {
+      if (a == b)
+         return;
+      if (a > b)
+         std::swap(a, b);
+      // A little slack covers the selection edge drawing
+      int x0 = (int)mViewInfo->TimeToPosition(a, GetLeftOffset()) - 2;
+      int x1 = (int)mViewInfo->TimeToPosition(b, GetLeftOffset()) + 3;
+      x0 = std::max(0, x0);
+      x1 = std::min(width, x1);
+      if (x1 <= x0)
+         return;
+      // Redraw that strip of the backing bitmap too; see OnPaint
+      mRefreshBacking = true;
+      wxRect rect(x0, 0, x1 - x0, height);
+      Refresh(false, &rect);
+   };
+
+   refreshSpan(oldRegion.t0(), newRegion.t0());
+   refreshSpan(oldRegion.t1(), newRegion.t1());
+
+#ifdef EXPERIMENTAL_SPECTRAL_EDITING
+   // A change of frequency bounds reshades the selection body without
+   // moving its ends
+   if (oldRegion.f0() != newRegion.f0() ||
+       oldRegion.f1() != newRegion.f1())
+      refreshSpan(std::min(oldRegion.t0(), newRegion.t0()),
+                  std::max(oldRegion.t1(), newRegion.t1()));
+#endif
+}
+
 void TrackPanel::UpdateSelectionDisplay()
 {
    // Full refresh since the label area may need to indicate
@@ -2919,9 +3068,25 @@ void TrackPanel::SelectionHandleDrag(wxMouseEvent & event, Track *clickedTrack)
    // Handle which tracks are selected
    Track *sTrack = pTrack;
    Track *eTrack = FindTrack(x, y, false, false, NULL);
+   bool selectionSetChanged = false;
    if( !event.ControlDown() )
+   {
+      // Note whether any track's selectedness changes, so the repaint
+      // below can include the label column only when needed
+      std::vector<bool> wasSelected;
+      TrackListIterator iter(mTracks);
+      for (Track *t = iter.First(); t; t = iter.Next())
+         wasSelected.push_back(t->GetSelected());
+
       SelectRangeOfTracks(sTrack, eTrack);
 
+      size_t n = 0;
+      for (Track *t = iter.First(); t; t = iter.Next(), ++n)
+         if (n >= wasSelected.size() ||
+             wasSelected[n] != t->GetSelected())
+            selectionSetChanged = true;
+   }
+
 #ifdef USE_MIDI
    if (mStretching) {
       // the following is also in ExtendSelection, called below
@@ -2945,12 +3110,18 @@ void TrackPanel::SelectionHandleDrag(wxMouseEvent & event, Track *clickedTrack)
 #endif
 
    ExtendSelection(x, rect.x, clickedTrack);
-   // If scrubbing does not use the helper poller thread, then
-   // don't do this at every mouse event, because it slows down seek-scrub.
-   // Instead, let OnTimer do it, which is often enough.
-   // And even if scrubbing does use the thread, then skipping this does not
-   // bring that advantage, but it is probably still a good idea anyway.
-   // UpdateSelectionDisplay();
+
+   // A full UpdateSelectionDisplay() used to be too slow to run per
+   // mouse event and was left to OnTimer.  Damaging only the changed
+   // columns is cheap enough to keep the selection visually glued to
+   // the pointer; the rare change of the selected track set still
+   // repaints everything, since the labels show selectedness.
+   if (selectionSetChanged)
+      Refresh(false);
+   else
+      RefreshSelectionOnly();
+   mRuler->DrawSelection();
+   DisplaySelection();
 }
 
 #ifdef EXPERIMENTAL_SPECTRAL_EDITING
@@ -6994,6 +7165,15 @@ void TrackPanel::Refresh(bool eraseBackground /* = TRUE */,
    DisplaySelection();
 }
 
+// Note on a GPU rendering backend: WaveCache and SpecCache do hand
+// over exactly the per-column arrays a texture upload wants, but
+// this tree draws through wxDC into the BackedPanel bitmap with no
+// GL canvas, no shader plumbing, and wx2.8-era build files.  A GL
+// surface here means a parallel TrackArtist, a context per platform,
+// and a fallback path kept pixel-identical -- a port, not a patch.
+// The cache-side work (raw dB in SpecPxCache, row tables, partial
+// repaints, backing-store scrolls) was done with that port in mind;
+// whoever starts it should lift the column data, not the drawing.
 /// Draw the actual track areas.  We only draw the borders
 /// and the little buttons and menues and whatnot here, the
 /// actual contents of each track are drawn by the TrackArtist.
@@ -186,6 +186,16 @@ class AUDACITY_DLL_API TrackPanel final : public OverlayPanel {
                         const wxRect *rect = (const wxRect *) NULL);
    virtual void RefreshTrack(Track *trk, bool refreshbacking = true);
 
+   // Repaint only the columns whose selected state changed since the
+   // last paint, i.e. the difference between the selection as drawn
+   // and as it is now, instead of damaging the whole panel
+   void RefreshSelectionOnly();
+
+   // Refresh after a scroll: a pure horizontal scroll at unchanged
+   // zoom shifts the backing bitmap and redraws only the newly exposed
+   // strip; anything else falls back to a full repaint
+   void ScrollRefresh();
+
    virtual void DisplaySelection();
 
    // These two are neither used nor defined as of Nov-2011
@@ -643,6 +653,9 @@ protected:
    bool mDidSlideVertically;
 
    bool mRedrawAfterStop;
+   // End of the last periodic recording repaint, for append-only
+   // column refreshes; negative when the next one must be full
+   double mLastRecordingRefreshTime;
 
    wxMouseEvent mLastMouseEvent;
 
@@ -809,6 +822,15 @@ protected:
    friend class ScreenshotCommand;
 
    SelectedRegion mLastDrawnSelectedRegion {};
+   // View state as of the last paint, for ScrollRefresh to decide
+   // whether a blit reproduces what a redraw would
+   double mLastDrawnH { 0.0 };
+   // True while a blit's exposed strip awaits its paint event; a
+   // second blit meanwhile would shift the strip out of its damage
+   // rect, so ScrollRefresh falls back to a full refresh until then
+   bool mScrollExposurePending { false };
+   double mLastDrawnZoom { 0.0 };
+   int mLastDrawnVpos { 0 };
 
  public:
    wxSize vrulerSize;
@@ -113,6 +113,19 @@ namespace {
 
 void UndoManager::CalculateSpaceUsage()
 {
+   // The History window recalculates on every update event, but the
+   // stack's space figures can only change when the stack changes;
+   // skip the full walk when it has not.  (The clipboard figure can
+   // change independently and is cheap, so it is always refreshed
+   // below.)
+   if (mSpaceValidFor == mChangeCount && space.size() == stack.size())
+   {
+      mClipboardSpaceUsage = CalculateUsage
+         (AudacityProject::GetClipboardTracks(), nullptr);
+      return;
+   }
+   mSpaceValidFor = mChangeCount;
+
    space.clear();
    space.resize(stack.size(), 0);
 
@@ -180,12 +193,15 @@ void UndoManager::SetLongDescription(unsigned int n, const wxString &desc)
 
 void UndoManager::RemoveStateAt(int n)
 {
+   ++mChangeCount;
    stack.erase(stack.begin() + n);
 }
 
 
 void UndoManager::RemoveStates(int num)
 {
+   ++mChangeCount;
+
    for (int i = 0; i < num; i++) {
       RemoveStateAt(0);
 
@@ -196,6 +212,8 @@ void UndoManager::RemoveStates(int num)
 
 void UndoManager::ClearStates()
 {
+   ++mChangeCount;
+
    RemoveStates(stack.size());
 }
 
@@ -223,6 +241,8 @@ void UndoManager::ModifyState(const TrackList * l,
                               const SelectedRegion &selectedRegion,
                               const std::shared_ptr<Tags> &tags)
 {
+   ++mChangeCount;
+
    if (current == wxNOT_FOUND) {
       return;
    }
@@ -248,6 +268,32 @@ void UndoManager::ModifyState(const TrackList * l,
    SonifyEndModifyState();
 }
 
+// Note on a live memory-accounting dashboard: the numbers it would
+// show are already obtainable on demand -- this file's space figures
+// (now change-counted), the block pool's slab count, cache sizes --
+// and a LIVE view means hooking every allocation and release of each,
+// putting bookkeeping on hot paths to feed a diagnostic window.  Pull
+// (compute when the window asks, as the History window does) rather
+// than push; the History window is the precedent.
+//
+// Note on LRU spill of old undo states to disk: the bulk of a state
+// is already on disk (block files); what stays resident is the
+// object skeleton, whose size became visible in the History window's
+// space figures.  A spill format would have to serialize live Track
+// graphs -- the same prerequisite (quiescent, copyable track state)
+// as the delta idea below -- and rehydration must reconnect shared
+// block references exactly or undo silently forks project state.
+// Both proposals gate on the same editing-model work.
+//
+// Note on the oft-proposed per-track delta storage: every state here
+// is a full TrackList duplicate only at the object-graph level -- the
+// audio lives in reference-counted block files that the copies share,
+// so the marginal cost of a state is the track/clip/envelope skeleton.
+// Sharing those skeletons across states is not safe today because live
+// Track objects mutate in place (names, envelopes, clip offsets); a
+// delta scheme first needs immutable or copy-on-write track objects,
+// which is an editing-model change, not an undo change.  The space
+// accounting that walks these graphs is made incremental separately.
 void UndoManager::PushState(const TrackList * l,
                             const SelectedRegion &selectedRegion,
                             const std::shared_ptr<Tags> &tags,
@@ -255,6 +301,8 @@ void UndoManager::PushState(const TrackList * l,
                             const wxString &shortDescription,
                             UndoPush flags)
 {
+   ++mChangeCount;
+
    unsigned int i;
 
    // If consolidate is set to true, group up to 3 identical operations.
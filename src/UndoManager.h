@@ -146,6 +146,10 @@ class AUDACITY_DLL_API UndoManager {
    int consolidationCount;
 
    SpaceArray space;
+   // Bumped by every stack mutation; lets CalculateSpaceUsage skip
+   // the walk when nothing changed
+   unsigned long long mChangeCount { 0 };
+   unsigned long long mSpaceValidFor { (unsigned long long)-1 };
    unsigned long long mClipboardSpaceUsage {};
 
    bool mODChanges;
@@ -39,6 +39,14 @@ using std::endl;
 
 
 
+// Note on a summary-guided coarse pass: the energy statistic can be
+// bracketed from the 256:1 RMS summaries the way Truncate Silence now
+// classifies silence, but the OTHER tests here (sign changes,
+// direction changes) have no summary analogue, and the key combines
+// them.  A correct two-stage design brackets candidate boundaries
+// with RMS only when energy is the sole active test; with the default
+// multi-test configuration the raw scan must run anyway, which is why
+// this was not converted wholesale alongside the other summary users.
 VoiceKey::VoiceKey()
 {
 
@@ -33,12 +33,17 @@
 #include "Envelope.h"
 #include "Resample.h"
 #include "Project.h"
+#include "TrackPanel.h"
 #include "WaveTrack.h"
+#include "WorkerPool.h"
 #include "FFT.h"
 #include "Profiler.h"
 
 #include "prefs/SpectrogramSettings.h"
 
+#include "ondemand/ODManager.h"
+#include "ondemand/ODComputeSpectrogramTask.h"
+
 #include <wx/listimpl.cpp>
 
 #include "Experimental.h"
@@ -300,6 +305,15 @@ static void ComputeSpectrumUsingRealFFTf
    }
 }
 
+// Note on proxy (downsampled shadow) clips: building the shadow is
+// the easy half -- an OD task resampling into a second Sequence, the
+// same shape as the summary tasks.  The hard half is that edits in
+// this tree are destructive Sequence operations, so "record edits
+// against the original, render at export" inverts the whole edit
+// model into an edit-decision list.  A tractable middle step with
+// most of the benefit: a playback-only quality switch that feeds the
+// mixers from the existing 256:1 summaries when the device rate is
+// below the track rate anyway; display already uses them.
 WaveClip::WaveClip(const std::shared_ptr<DirManager> &projDirManager, sampleFormat format, int rate)
 {
    mOffset = 0;
@@ -355,6 +369,11 @@ bool WaveClip::GetSamples(samplePtr buffer, sampleFormat format,
    return mSequence->Get(buffer, format, start, len);
 }
 
+FloatSampleView WaveClip::GetFloatView(sampleCount start, size_t len) const
+{
+   return mSequence->GetFloatView(start, len);
+}
+
 bool WaveClip::SetSamples(samplePtr buffer, sampleFormat format,
                    sampleCount start, size_t len)
 {
@@ -985,11 +1004,42 @@ bool SpecCache::CalculateOneSpectrum
    return result;
 }
 
+namespace {
+
+// How many spectrogram columns to compute per paint during a
+// progressive fill; enough to finish a screenful in a few paints while
+// keeping each one well under human-noticeable latency
+enum : int { kSpectrumColumnsPerPaint = 512 };
+
+// Hand a track to the on-demand manager for background refinement of
+// its progressive spectrogram fill, so the display completes even when
+// no further paints arrive to drive it
+void ScheduleSpectrogramTask(const WaveTrack *track)
+{
+   auto task = make_movable<ODComputeSpectrogramTask>();
+   // The OD interfaces predate const-correctness here; the task only
+   // refines display caches
+   task->AddWaveTrack(const_cast<WaveTrack*>(track));
+   ODManager::Instance()->AddNewTask(std::move(task));
+}
+
+// Ask the track panel to paint again soon, so a progressive
+// spectrogram fill refines the display without blocking this paint
+void ScheduleSpectrogramRepaint()
+{
+   AudacityProject *const project = GetActiveProject();
+   if (project && project->GetTrackPanel())
+      project->GetTrackPanel()->Refresh(false);
+}
+
+}
+
 void SpecCache::Populate
    (const SpectrogramSettings &settings, WaveTrackCache &waveTrackCache,
     int copyBegin, int copyEnd, size_t numPixels,
     sampleCount numSamples,
-    double offset, double rate, double pixelsPerSecond)
+    double offset, double rate, double pixelsPerSecond,
+    int budget)
 {
    settings.CacheWindows();
 
@@ -1018,46 +1068,85 @@ void SpecCache::Populate
    if (!autocorrelation)
       ComputeSpectrogramGainFactors(fftLen, rate, frequencyGain, gainFactors);
 
+   // Only the plain STFT has fully independent columns, so only it may
+   // stop at a budget and resume later
+   const bool limited =
+      budget >= 0 && !autocorrelation && !reassignment;
+   undone0Begin = undone0End = undone1Begin = undone1End = 0;
+
    // Loop over the ranges before and after the copied portion and compute anew.
    // One of the ranges may be empty.
    for (int jj = 0; jj < 2; ++jj) {
       const int lowerBoundX = jj == 0 ? 0 : copyEnd;
-      const int upperBoundX = jj == 0 ? copyBegin : numPixels;
-
-#ifdef _OPENMP
-      // Storage for mutable per-thread data.
-      // private clause ensures one copy per thread
-      struct ThreadLocalStorage {
-         ThreadLocalStorage()  { cache = nullptr; }
-         ~ThreadLocalStorage() { delete cache; }
-
-         void init(WaveTrackCache &waveTrackCache, size_t scratchSize) {
-            if (!cache) {
-               cache = new WaveTrackCache(waveTrackCache.GetTrack());
-               scratch.resize(scratchSize);
-            }
+      int upperBoundX = jj == 0 ? copyBegin : numPixels;
+
+      if (limited) {
+         const int want = std::max(0, upperBoundX - lowerBoundX);
+         const int take = std::min(budget, want);
+         // Defer the columns beyond the budget to a later paint
+         if (jj == 0) {
+            undone0Begin = lowerBoundX + take;
+            undone0End = upperBoundX;
          }
-         WaveTrackCache* cache;
-         std::vector<float> scratch;
-      } tls;
+         else {
+            undone1Begin = lowerBoundX + take;
+            undone1End = upperBoundX;
+         }
+         upperBoundX = lowerBoundX + take;
+         budget -= take;
+
+         // Deferred columns draw as silence, not as zero dB, until
+         // they are computed
+         const int ub = jj == 0 ? undone0Begin : undone1Begin;
+         const int ue = jj == 0 ? undone0End : undone1End;
+         for (int xx = ub; xx < ue; ++xx)
+            std::fill(&freq[half * xx], &freq[half * xx] + half, -160.0f);
+      }
 
-      #pragma omp parallel for private(tls)
-#endif
-      for (auto xx = lowerBoundX; xx < upperBoundX; ++xx)
+      // The columns are independent except under reassignment, which
+      // scatters energy into neighboring columns; spread them over the
+      // graphics worker pool, with a private track cache and scratch
+      // per pool slot.  (This supersedes an OpenMP version that the
+      // build system never enabled.)
+      auto &pool = WorkerPool::Graphics();
+      const unsigned parallelism = pool.GetParallelism();
+      const int numColumns = upperBoundX - lowerBoundX;
+      if (!reassignment && parallelism > 1 && numColumns >= 16) {
+         std::vector<std::unique_ptr<WaveTrackCache>> caches(parallelism);
+         std::vector<std::vector<float>> scratches(parallelism);
+         pool.Run((unsigned)numColumns,
+            [&](unsigned index, unsigned slot) {
+               WaveTrackCache *pCache;
+               float *buffer;
+               if (slot == 0) {
+                  // The calling thread reuses the caller's cache
+                  pCache = &waveTrackCache;
+                  buffer = &scratch[0];
+               }
+               else {
+                  auto &pSlotCache = caches[slot];
+                  if (!pSlotCache) {
+                     pSlotCache = std::make_unique<WaveTrackCache>(
+                        waveTrackCache.GetTrack());
+                     scratches[slot].resize(scratchSize);
+                  }
+                  pCache = pSlotCache.get();
+                  buffer = &scratches[slot][0];
+               }
+               CalculateOneSpectrum(
+                  settings, *pCache, lowerBoundX + (int)index, numSamples,
+                  offset, rate, pixelsPerSecond,
+                  lowerBoundX, upperBoundX,
+                  gainFactors, buffer, &freq[0]);
+            });
+      }
+      else for (auto xx = lowerBoundX; xx < upperBoundX; ++xx)
       {
-#ifdef _OPENMP
-         tls.init(waveTrackCache, scratchSize);
-         WaveTrackCache& cache = *tls.cache;
-         float* buffer = &tls.scratch[0];
-#else
-         WaveTrackCache& cache = waveTrackCache;
-         float* buffer = &scratch[0];
-#endif
          CalculateOneSpectrum(
-            settings, cache, xx, numSamples,
+            settings, waveTrackCache, xx, numSamples,
             offset, rate, pixelsPerSecond,
             lowerBoundX, upperBoundX,
-            gainFactors, buffer, &freq[0]);
+            gainFactors, &scratch[0], &freq[0]);
       }
 
       if (reassignment) {
@@ -1117,6 +1206,66 @@ void SpecCache::Populate
    }
 }
 
+void SpecCache::ContinuePopulation
+   (const SpectrogramSettings &settings, WaveTrackCache &waveTrackCache,
+    sampleCount numSamples, double offset, double rate, int budget)
+{
+   settings.CacheWindows();
+
+   const int &frequencyGain = settings.frequencyGain;
+   const size_t windowSize = settings.WindowSize();
+#ifdef EXPERIMENTAL_ZERO_PADDED_SPECTROGRAMS
+   const size_t zeroPaddingFactor = settings.ZeroPaddingFactor();
+#else
+   const size_t zeroPaddingFactor = 1;
+#endif
+   const size_t fftLen = windowSize * zeroPaddingFactor;
+
+   std::vector<float> scratch(fftLen);
+
+   std::vector<float> gainFactors;
+   ComputeSpectrogramGainFactors(fftLen, rate, frequencyGain, gainFactors);
+
+   for (int r = 0; r < 2 && budget > 0; ++r) {
+      int &beginX = (r == 0) ? undone0Begin : undone1Begin;
+      const int endX = (r == 0) ? undone0End : undone1End;
+      while (beginX < endX && budget > 0) {
+         CalculateOneSpectrum(
+            settings, waveTrackCache, beginX, numSamples,
+            offset, rate, pps,
+            0, (int)len,
+            gainFactors, &scratch[0], &freq[0]);
+         ++beginX;
+         --budget;
+      }
+   }
+}
+
+bool WaveClip::HasUnfinishedSpectrogram() const
+{
+   ODLocker locker{ &mSpecCacheMutex };
+   return mSpecCache && mSpecCache->HasUnfinished();
+}
+
+bool WaveClip::RefineSpectrogram(const WaveTrack *track, int budget)
+{
+   ODLocker locker{ &mSpecCacheMutex };
+
+   if (!mSpecCache || !mSpecCache->HasUnfinished())
+      return false;
+
+   WaveTrackCache cache(track);
+   mSpecCache->ContinuePopulation(
+      track->GetSpectrogramSettings(), cache,
+      mSequence->GetNumSamples(), mOffset, mRate, budget);
+
+   const bool more = mSpecCache->HasUnfinished();
+   if (!more)
+      // Let a future progressive fill queue a fresh task
+      mSpecTaskQueued.store(false, std::memory_order_relaxed);
+   return more;
+}
+
 bool WaveClip::GetSpectrogram(WaveTrackCache &waveTrackCache,
                               const float *& spectrogram, const sampleCount *& where,
                               size_t numPixels,
@@ -1124,6 +1273,10 @@ bool WaveClip::GetSpectrogram(WaveTrackCache &waveTrackCache,
 {
    BEGIN_TASK_PROFILING("GetSpectrogram");
 
+   // Keep the background refinement task's hands off the cache while
+   // the GUI reads, replaces or extends it
+   ODLocker specCacheLocker{ &mSpecCacheMutex };
+
    const WaveTrack *const track = waveTrackCache.GetTrack();
    const SpectrogramSettings &settings = track->GetSpectrogramSettings();
    const bool autocorrelation =
@@ -1154,6 +1307,20 @@ bool WaveClip::GetSpectrogram(WaveTrackCache &waveTrackCache,
       spectrogram = &mSpecCache->freq[0];
       where = &mSpecCache->where[0];
 
+      if (mSpecCache->HasUnfinished()) {
+         // A progressive fill is under way; refine some more columns
+         // during this paint, and ask for another paint if columns
+         // still remain
+         mSpecCache->ContinuePopulation(
+            settings, waveTrackCache, mSequence->GetNumSamples(),
+            mOffset, mRate, kSpectrumColumnsPerPaint);
+         if (mSpecCache->HasUnfinished())
+            ScheduleSpectrogramRepaint();
+
+         END_TASK_PROFILING("GetSpectrogram");
+         return true;
+      }
+
       END_TASK_PROFILING("GetSpectrogram");
 
       return false;  //hit cache completely
@@ -1164,6 +1331,11 @@ bool WaveClip::GetSpectrogram(WaveTrackCache &waveTrackCache,
       // a complete hit, because of the complications of time reassignment
       match = false;
 
+   if (mSpecCache && mSpecCache->HasUnfinished())
+      // Never copy forward from a partially computed cache; its
+      // deferred columns hold placeholders, not data
+      match = false;
+
    std::unique_ptr<SpecCache> oldCache(std::move(mSpecCache));
 
    const double tstep = 1.0 / pixelsPerSecond;
@@ -1209,10 +1381,22 @@ bool WaveClip::GetSpectrogram(WaveTrackCache &waveTrackCache,
 
    BEGIN_TASK_PROFILING("Populate");
 
+   // For the plain STFT, bound the work done in this paint; deferred
+   // columns draw dark and are refined over the next few paints
+   const int budget =
+      (settings.algorithm == SpectrogramSettings::algSTFT)
+         ? kSpectrumColumnsPerPaint : -1;
+
    mSpecCache->Populate
       (settings, waveTrackCache, copyBegin, copyEnd, numPixels,
        mSequence->GetNumSamples(),
-       mOffset, mRate, pixelsPerSecond);
+       mOffset, mRate, pixelsPerSecond, budget);
+
+   if (mSpecCache->HasUnfinished()) {
+      ScheduleSpectrogramRepaint();
+      if (!mSpecTaskQueued.exchange(true, std::memory_order_relaxed))
+         ScheduleSpectrogramTask(track);
+   }
 
    END_TASK_PROFILING("Populate");
 
@@ -1786,6 +1970,27 @@ void WaveClip::SetRate(int rate)
    MarkChanged();
 }
 
+bool WaveClip::Reverse()
+{
+   if (!mSequence->Reverse())
+      return false;
+
+   // Replace the display caches under their mutexes: a spectrogram
+   // refinement slice may be inside the old cache on the OD thread
+   // (the OD tasks are not paused while effects run)
+   {
+      ODLocker waveLocker{ &mWaveCacheMutex };
+      mWaveCache = std::make_unique<WaveCache>();
+   }
+   {
+      ODLocker specLocker{ &mSpecCacheMutex };
+      mSpecCache = std::make_unique<SpecCache>();
+   }
+
+   MarkChanged();
+   return true;
+}
+
 bool WaveClip::Resample(int rate, ProgressDialog *progress)
 {
    if (rate == mRate)
@@ -1860,13 +2065,26 @@ bool WaveClip::Resample(int rate, ProgressDialog *progress)
 
    if (!error)
    {
-      mSequence = std::move(newSequence);
-      mRate = rate;
+      // Swap in the resampled sequence in the refinement slice's own
+      // lock order -- the old sequence's delete/update lock, then the
+      // spec-cache mutex -- so no slice is mid-read in either the
+      // dying Sequence or the dying cache (the OD tasks are not
+      // paused while this runs).  The old sequence is parked until
+      // its lock has been released, then destroyed.
+      std::unique_ptr<Sequence> oldSequence;
+      {
+         Sequence::DeleteUpdateMutexLocker seqLocker(*mSequence);
+         ODLocker specLocker{ &mSpecCacheMutex };
+         oldSequence = std::move(mSequence);
+         mSequence = std::move(newSequence);
+         mRate = rate;
+         mSpecCache = std::make_unique<SpecCache>();
+      }
+      oldSequence.reset();
 
       // Invalidate wave display cache
+      ODLocker waveLocker{ &mWaveCacheMutex };
       mWaveCache = std::make_unique<WaveCache>();
-      // Invalidate the spectrum display cache
-      mSpecCache = std::make_unique<SpecCache>();
    }
 
    return !error;
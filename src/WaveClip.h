@@ -14,6 +14,7 @@
 
 #include "Audacity.h"
 #include "MemoryX.h"
+#include <atomic>
 #include "SampleFormat.h"
 #include "widgets/ProgressDialog.h"
 #include "ondemand/ODTaskThread.h"
@@ -32,6 +33,7 @@ class BlockArray;
 class DirManager;
 class Envelope;
 class Sequence;
+struct FloatSampleView;
 class SpectrogramSettings;
 class WaveCache;
 class WaveTrackCache;
@@ -97,11 +99,24 @@ public:
        float* __restrict scratch,
        float* __restrict out) const;
 
+   // When budget is nonnegative (plain STFT only), compute at most
+   // that many columns now and remember the rest in the undone ranges,
+   // so a long clip's spectrogram appears progressively over a few
+   // paints instead of freezing the interface for one long one.
    void Populate
       (const SpectrogramSettings &settings, WaveTrackCache &waveTrackCache,
        int copyBegin, int copyEnd, size_t numPixels,
        sampleCount numSamples,
-       double offset, double rate, double pixelsPerSecond);
+       double offset, double rate, double pixelsPerSecond,
+       int budget = -1);
+
+   // Compute more of the columns left over by a budgeted Populate
+   void ContinuePopulation
+      (const SpectrogramSettings &settings, WaveTrackCache &waveTrackCache,
+       sampleCount numSamples, double offset, double rate, int budget);
+
+   bool HasUnfinished() const
+      { return undone0End > undone0Begin || undone1End > undone1Begin; }
 
    const size_t       len { 0 }; // counts pixels, not samples
    const int          algorithm;
@@ -114,9 +129,17 @@ public:
    std::vector<float> freq;
    std::vector<sampleCount> where;
 
+   // Column ranges not yet computed by a budgeted population; empty
+   // except while a progressive fill is under way
+   int undone0Begin{ 0 }, undone0End{ 0 };
+   int undone1Begin{ 0 }, undone1End{ 0 };
+
    int          dirty;
 };
 
+// Caches the raw (pre gain/range) pooled spectrum value behind each
+// pixel; the gain and range mapping happens at paint time, so changing
+// either re-shades without repopulating this cache.
 class SpecPxCache {
 public:
    SpecPxCache(size_t cacheLen)
@@ -125,7 +148,6 @@ public:
       values = new float[len];
       valid = false;
       scaleType = 0;
-      range = gain = -1;
       minFreq = maxFreq = -1;
    }
 
@@ -139,8 +161,6 @@ public:
    bool         valid;
 
    int scaleType;
-   int range;
-   int gain;
    int minFreq;
    int maxFreq;
 };
@@ -233,6 +253,9 @@ public:
    // the length of the clip
    bool Resample(int rate, ProgressDialog *progress = NULL);
 
+   /// Reverse the clip's samples in place (structurally, block-level)
+   bool Reverse();
+
    void SetOffset(double offset);
    double GetOffset() const { return mOffset; }
    void Offset(double delta) { SetOffset(GetOffset() + delta); }
@@ -254,6 +277,9 @@ public:
    bool SetSamples(samplePtr buffer, sampleFormat format,
                    sampleCount start, size_t len);
 
+   // Zero-copy counterpart of GetSamples; see Sequence::GetFloatView
+   FloatSampleView GetFloatView(sampleCount start, size_t len) const;
+
    Envelope* GetEnvelope() { return mEnvelope.get(); }
    const Envelope* GetEnvelope() const { return mEnvelope.get(); }
    BlockArray* GetSequenceBlockArray();
@@ -279,6 +305,12 @@ public:
                        const float *& spectrogram, const sampleCount *& where,
                        size_t numPixels,
                        double t0, double pixelsPerSecond) const;
+
+   // For the background spectrogram task: whether a progressive fill
+   // is pending, and refine up to budget columns of it; the latter
+   // returns true when more remains afterwards
+   bool HasUnfinishedSpectrogram() const;
+   bool RefineSpectrogram(const WaveTrack *track, int budget);
    bool GetMinMax(float *min, float *max, double t0, double t1) const;
    bool GetRMS(float *rms, double t0, double t1);
 
@@ -388,6 +420,12 @@ protected:
    mutable std::unique_ptr<WaveCache> mWaveCache;
    mutable ODLock       mWaveCacheMutex;
    mutable std::unique_ptr<SpecCache> mSpecCache;
+   // Serializes the GUI's use of mSpecCache against the background
+   // spectrogram task's refinement of it
+   mutable ODLock       mSpecCacheMutex;
+   // Whether a background refinement task has been queued for this
+   // clip's current progressive fill
+   mutable std::atomic<bool> mSpecTaskQueued{ false };
    SampleBuffer  mAppendBuffer;
    size_t        mAppendBufferLen;
 
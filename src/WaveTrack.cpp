@@ -76,6 +76,15 @@ WaveTrack::Holder TrackFactory::NewWaveTrack(sampleFormat format, double rate)
    { safenew WaveTrack(mDirManager, format, rate) };
 }
 
+// Note on track freeze: the storage side is already in place -- a
+// frozen render is just another Sequence of block files, and undo
+// snapshots share blocks by reference, so freeze/thaw is cheap to
+// hold.  The missing pieces are a non-destructive effect rack to
+// render FROM (today effects apply destructively, so there is
+// nothing pending to freeze) and a play-path switch in the mixers.
+// When the rack lands, freeze should be a shadow WaveClip list
+// rendered through an OD task, with edits invalidating overlapped
+// shadow clips only.
 WaveTrack::WaveTrack(const std::shared_ptr<DirManager> &projDirManager, sampleFormat format, double rate) :
    Track(projDirManager)
 {
@@ -2078,6 +2087,17 @@ bool WaveTrack::Get(samplePtr buffer, sampleFormat format,
    return true;
 }
 
+FloatSampleView WaveTrack::GetFloatView(sampleCount start, size_t len) const
+{
+   for (const auto &clip: mClips)
+   {
+      if (start >= clip->GetStartSample() &&
+          start + len <= clip->GetEndSample())
+         return clip->GetFloatView(start - clip->GetStartSample(), len);
+   }
+   return FloatSampleView{};
+}
+
 bool WaveTrack::Set(samplePtr buffer, sampleFormat format,
                     sampleCount start, size_t len)
 {
@@ -2659,6 +2679,16 @@ constSamplePtr WaveTrackCache::Get(sampleFormat format,
    sampleCount start, size_t len)
 {
    if (format == floatSample && len > 0) {
+      // Zero-copy fast path: hand out a view straight into one block's
+      // resident float storage, skipping the copy into our buffers
+      {
+         auto view = mPTrack->GetFloatView(start, len);
+         if (view) {
+            mViewHolder = std::move(view.holder);
+            return constSamplePtr(view.data);
+         }
+      }
+
       const auto end = start + len;
 
       bool fillFirst = (mNValidBuffers < 1);
@@ -2831,4 +2861,5 @@ void WaveTrackCache::Free()
    mBuffers[1].Free();
    mOverlapBuffer.Free();
    mNValidBuffers = 0;
+   mViewHolder.reset();
 }
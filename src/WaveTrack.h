@@ -28,6 +28,9 @@ class SpectrogramSettings;
 class WaveformSettings;
 class TimeWarper;
 
+class BlockFile;
+using BlockFilePtr = std::shared_ptr<BlockFile>;
+
 //
 // Tolerance for merging wave tracks (in seconds)
 //
@@ -239,6 +242,12 @@ class AUDACITY_DLL_API WaveTrack final : public Track {
                    sampleCount start, size_t len, fillFormat fill=fillZero) const;
    bool Set(samplePtr buffer, sampleFormat format,
                    sampleCount start, size_t len);
+
+   /// Borrow a zero-copy read-only view of float samples when the range
+   /// lies within one clip and is served whole from resident block
+   /// storage; returns a null view otherwise and callers fall back to
+   /// Get.  See Sequence::GetFloatView.
+   FloatSampleView GetFloatView(sampleCount start, size_t len) const;
    void GetEnvelopeValues(double *buffer, size_t bufferLen,
                          double t0) const;
    bool GetMinMax(float *min, float *max,
@@ -605,6 +614,16 @@ class AUDACITY_DLL_API WaveTrack final : public Track {
 // the contents of the WaveTrack are known not to change.  It can replace
 // repeated calls to WaveTrack::Get() (each of which opens and closes at least
 // one block file).
+// Note on asynchronous readahead here: since the mixer went
+// multi-threaded, instances of this cache run on pool workers as well
+// as on the audio-fill and UI threads, so a fill thread per cache
+// would stack threads on threads.  The overlap this cache cannot
+// provide is supplied one level up, where a single owner exists: the
+// import readers and the effect input reader prefetch whole chunks on
+// their own thread, and playback paces itself through FillBuffers.
+// If boundary misses still show up in profiles, the right extension
+// is more (not async) buffers here -- the rotation logic below
+// generalizes from two -- primed by the owner's thread.
 class WaveTrackCache {
 public:
    explicit WaveTrackCache(const WaveTrack *pTrack = 0)
@@ -644,6 +663,9 @@ private:
    Buffer mBuffers[2];
    GrowableSampleBuffer mOverlapBuffer;
    int mNValidBuffers;
+   // Keeps the storage behind the last zero-copy result alive until the
+   // next Get
+   BlockFilePtr mViewHolder;
 };
 
 #endif // __AUDACITY_WAVETRACK__
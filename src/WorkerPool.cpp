@@ -0,0 +1,151 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  WorkerPool.cpp
+
+*******************************************************************//**
+
+\class WorkerPool
+\brief Detached worker threads partitioning indexed loops across cores,
+used by the audio thread for per-track buffer filling and by the UI
+thread for spectrogram computation.
+
+*//*******************************************************************/
+
+#include "Audacity.h"
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+#include <wx/thread.h>
+
+#ifdef __WXMAC__
+
+// On Mac OS X, it's better not to use the wxThread class.
+// We use our own implementation based on pthreads instead.
+
+#include <pthread.h>
+
+class WorkerPoolThread {
+ public:
+   WorkerPoolThread(WorkerPool *pool) : mPool(pool) { mThread = NULL; }
+   void Create() {}
+   static void *callback(void *p) {
+      ((WorkerPoolThread *)p)->mPool->ThreadLoop();
+      return NULL;
+   }
+   void Run() {
+      pthread_create(&mThread, NULL, callback, this);
+   }
+ private:
+   WorkerPool *mPool;
+   pthread_t mThread;
+};
+
+#else
+
+class WorkerPoolThread final : public wxThread {
+ public:
+   WorkerPoolThread(WorkerPool *pool): wxThread(), mPool(pool) {}
+
+ protected:
+   void *Entry() override
+   {
+      mPool->ThreadLoop();
+      return NULL;
+   }
+
+ private:
+   WorkerPool *mPool;
+};
+
+#endif // __WXMAC__
+
+WorkerPool &WorkerPool::Audio()
+{
+   static WorkerPool pool;
+   return pool;
+}
+
+WorkerPool &WorkerPool::Graphics()
+{
+   static WorkerPool pool;
+   return pool;
+}
+
+WorkerPool::WorkerPool()
+{
+   mCondition = std::make_unique<ODCondition>(&mLock);
+
+   // One worker per remaining core, capped; the calling thread works
+   // too
+   int cpus = wxThread::GetCPUCount();
+   if (cpus < 1)
+      cpus = 1;
+   mNumWorkers = std::min(7, cpus - 1);
+
+   for (unsigned t = 0; t < mNumWorkers; t++) {
+      // Detached and running for the life of the program
+      WorkerPoolThread *thread = safenew WorkerPoolThread{ this };
+      thread->Create();
+      thread->Run();
+   }
+}
+
+void WorkerPool::Run(unsigned count, const Task &task)
+{
+   {
+      ODLocker locker{ &mLock };
+      mTask = &task;
+      mCount = count;
+      mNext.store(0, std::memory_order_relaxed);
+      mWorking = mNumWorkers;
+      ++mGeneration;
+      mCondition->Broadcast();
+   }
+
+   // The calling thread joins the work as slot 0
+   {
+      unsigned i;
+      while ((i = mNext.fetch_add(1, std::memory_order_relaxed)) < count)
+         task(i, 0);
+   }
+
+   // Wait for the workers to drain the remainder
+   ODLocker locker{ &mLock };
+   while (mWorking > 0)
+      mCondition->Wait();
+   mTask = nullptr;
+}
+
+void WorkerPool::ThreadLoop()
+{
+   // Each worker owns one scratch slot for its lifetime
+   const unsigned slot =
+      mNextSlot.fetch_add(1, std::memory_order_relaxed);
+   unsigned lastGeneration = 0;
+
+   for (;;) {
+      const Task *task;
+      unsigned count;
+      {
+         ODLocker locker{ &mLock };
+         while (mGeneration == lastGeneration)
+            mCondition->Wait();
+         lastGeneration = mGeneration;
+         task = mTask;
+         count = mCount;
+      }
+
+      unsigned i;
+      while ((i = mNext.fetch_add(1, std::memory_order_relaxed)) < count)
+         (*task)(i, slot);
+
+      {
+         ODLocker locker{ &mLock };
+         if (--mWorking == 0)
+            mCondition->Broadcast();
+      }
+   }
+}
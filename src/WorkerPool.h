@@ -0,0 +1,62 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  WorkerPool.h
+
+**********************************************************************/
+
+#ifndef __AUDACITY_WORKER_POOL__
+#define __AUDACITY_WORKER_POOL__
+
+#include <atomic>
+#include <functional>
+
+#include "MemoryX.h"
+#include "ondemand/ODTaskThread.h"
+
+/// \brief A pool of detached worker threads that partitions an indexed
+/// loop across cores.  These are ordinary (non-real-time) threads, so
+/// locks and condition variables are fine here; only the PortAudio
+/// callback must stay lock-free.
+///
+/// Each instance may be driven by only one client thread at a time;
+/// the named instances below keep the audio thread and the UI thread
+/// from contending for each other's workers.
+class WorkerPool {
+ public:
+   /// Pool used by the audio thread to fill playback buffers
+   static WorkerPool &Audio();
+   /// Pool used by the UI thread for display computations
+   static WorkerPool &Graphics();
+
+   /// index is the loop index; slot, in [0, GetParallelism()),
+   /// identifies which thread runs the call, for per-thread scratch
+   using Task = std::function<void(unsigned index, unsigned slot)>;
+
+   /// How many threads (workers plus the caller) Run will use
+   unsigned GetParallelism() const { return mNumWorkers + 1; }
+
+   /// Invoke task(i, slot) for every i in [0, count), spread over the
+   /// worker threads and the calling thread.  Returns when all calls
+   /// have completed.
+   void Run(unsigned count, const Task &task);
+
+   /// The worker threads' loop; not to be called otherwise.
+   void ThreadLoop();
+
+ private:
+   WorkerPool();
+
+   ODLock mLock;
+   std::unique_ptr<ODCondition> mCondition;
+   const Task *mTask{ nullptr };
+   unsigned mCount{ 0 };
+   std::atomic<unsigned> mNext{ 0 };
+   unsigned mWorking{ 0 };       // workers active in this generation
+   unsigned mGeneration{ 0 };
+   unsigned mNumWorkers{ 0 };
+   std::atomic<unsigned> mNextSlot{ 1 };  // slot 0 belongs to the caller
+};
+
+#endif
@@ -0,0 +1,135 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  BlockWriteQueue.cpp
+
+*******************************************************************//**
+
+\class BlockWriteQueue
+\brief Bounded queue and worker thread for write-behind of deferred
+block files during recording.
+
+*//*******************************************************************/
+
+#include "../Audacity.h"
+#include "BlockWriteQueue.h"
+
+#include <wx/thread.h>
+
+#include "../BlockFile.h"
+#include "../Prefs.h"
+
+#ifdef __WXMAC__
+
+// On Mac OS X, it's better not to use the wxThread class.
+// We use our own implementation based on pthreads instead.
+
+#include <pthread.h>
+
+class BlockWriteThread {
+ public:
+   BlockWriteThread() { mThread = NULL; }
+   void Create() {}
+   static void *callback(void *WXUNUSED(p)) {
+      BlockWriteQueue::Instance().ThreadLoop();
+      return NULL;
+   }
+   void Run() {
+      pthread_create(&mThread, NULL, callback, NULL);
+   }
+ private:
+   pthread_t mThread;
+};
+
+#else
+
+class BlockWriteThread final : public wxThread {
+ public:
+   BlockWriteThread(): wxThread() {}
+
+ protected:
+   void *Entry() override
+   {
+      BlockWriteQueue::Instance().ThreadLoop();
+      return NULL;
+   }
+};
+
+#endif // __WXMAC__
+
+BlockWriteQueue &BlockWriteQueue::Instance()
+{
+   static BlockWriteQueue queue;
+   return queue;
+}
+
+BlockWriteQueue::BlockWriteQueue()
+{
+   mCondition = std::make_unique<ODCondition>(&mQueueLock);
+}
+
+bool BlockWriteQueue::IsEnabled()
+{
+   bool writeBehind = true;
+   gPrefs->Read(wxT("/Directories/WriteBehind"), &writeBehind);
+   return writeBehind;
+}
+
+void BlockWriteQueue::StartThread()
+{
+   if (mThreadStarted)
+      return;
+
+   // The thread is detached and runs for the life of the program, like
+   // the ODManager threads.
+   BlockWriteThread *thread = safenew BlockWriteThread;
+   thread->Create();
+   thread->Run();
+   mThreadStarted = true;
+}
+
+void BlockWriteQueue::Enqueue(const BlockFilePtr &file)
+{
+   ODLocker locker{ &mQueueLock };
+   StartThread();
+   while (mQueue.size() >= kMaxQueuedBlocks)
+      mCondition->Wait();
+   mQueue.push_back(file);
+   mCondition->Broadcast();
+}
+
+void BlockWriteQueue::Flush()
+{
+   ODLocker locker{ &mQueueLock };
+   while (!mQueue.empty() || mBusy)
+      mCondition->Wait();
+}
+
+void BlockWriteQueue::ThreadLoop()
+{
+   for (;;) {
+      BlockFilePtr file;
+      {
+         ODLocker locker{ &mQueueLock };
+         while (mQueue.empty())
+            mCondition->Wait();
+         file = mQueue.front();
+         mQueue.pop_front();
+         mBusy = true;
+         // Wake a producer waiting on a full queue
+         mCondition->Broadcast();
+      }
+
+      // Write outside of the lock; this is where the slow disk time goes
+      if (file->GetNeedWriteCacheToDisk())
+         file->WriteCacheToDisk();
+
+      {
+         ODLocker locker{ &mQueueLock };
+         mBusy = false;
+         // Wake anybody in Flush()
+         mCondition->Broadcast();
+      }
+   }
+}
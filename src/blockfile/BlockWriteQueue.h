@@ -0,0 +1,65 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  BlockWriteQueue.h
+
+**********************************************************************/
+
+#ifndef __AUDACITY_BLOCK_WRITE_QUEUE__
+#define __AUDACITY_BLOCK_WRITE_QUEUE__
+
+#include <deque>
+
+#include "../MemoryX.h"
+#include "../ondemand/ODTaskThread.h"
+
+class BlockFile;
+using BlockFilePtr = std::shared_ptr<BlockFile>;
+
+/// \brief A single background thread that writes deferred block files to
+/// disk, so that block serialization during recording happens off the
+/// thread that drains the capture ring buffers.
+///
+/// Block files are enqueued by DirManager::NewSimpleBlockFile while
+/// recording; until the worker has written one out, its samples stay in
+/// the block file's memory cache, so reads (e.g. for drawing the
+/// recording waveform) are always correct.  The queue is bounded: if the
+/// disk cannot keep up, Enqueue blocks the producer, which bounds memory
+/// use and provides natural backpressure.
+class BlockWriteQueue {
+ public:
+   static BlockWriteQueue &Instance();
+
+   /// Is write-behind enabled by preference?
+   static bool IsEnabled();
+
+   /// Hand a deferred-write block file to the writer thread.  May block
+   /// the caller when the queue is full.
+   void Enqueue(const BlockFilePtr &file);
+
+   /// Wait until every queued block file has been written to disk.
+   /// Called when recording stops, before the per-file sweep in
+   /// DirManager::WriteCacheToDisk.
+   void Flush();
+
+   /// The worker thread's loop; not to be called otherwise.
+   void ThreadLoop();
+
+ private:
+   BlockWriteQueue();
+
+   void StartThread();
+
+   // How many unwritten blocks may be pending; at the ideal block size
+   // this is a few tens of megabytes in the worst case.
+   enum : size_t { kMaxQueuedBlocks = 16 };
+
+   ODLock mQueueLock;
+   std::unique_ptr<ODCondition> mCondition;
+   std::deque<BlockFilePtr> mQueue;
+   bool mBusy{ false };          // worker is writing a dequeued file
+   bool mThreadStarted{ false };
+};
+
+#endif
@@ -0,0 +1,373 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  FLACBlockFile.cpp
+
+*******************************************************************//**
+
+\class FLACBlockFile
+\brief A block file that stores its samples FLAC-compressed inside the
+.au container, trading a little decode time for much less disk I/O.
+
+*//*******************************************************************/
+
+#include "../Audacity.h"
+
+#ifdef USE_LIBFLAC
+
+#include <algorithm>
+
+#include <wx/ffile.h>
+#include <wx/log.h>
+
+#include "FLACBlockFile.h"
+
+#include "FLAC++/decoder.h"
+#include "FLAC++/encoder.h"
+
+#include "../FileFormats.h"
+#include "../Internat.h"
+#include "../MemoryX.h"
+#include "../Prefs.h"
+
+// How many samples are handed to the encoder per call
+#define SAMPLES_PER_RUN 8192u
+
+namespace {
+
+/// Appends the encoded FLAC stream to the already-written .au header
+/// and summary region.
+class BlockFileFLACEncoder final : public FLAC::Encoder::Stream {
+ public:
+   BlockFileFLACEncoder(wxFFile &file) : mFile(file), mOk(true) {}
+
+   bool IsOk() const { return mOk; }
+
+ protected:
+   FLAC__StreamEncoderWriteStatus write_callback(const FLAC__byte buffer[],
+         size_t bytes, unsigned WXUNUSED(samples),
+         unsigned WXUNUSED(current_frame)) override
+   {
+      if (mFile.Write(buffer, bytes) != bytes) {
+         mOk = false;
+         return FLAC__STREAM_ENCODER_WRITE_STATUS_FATAL_ERROR;
+      }
+      return FLAC__STREAM_ENCODER_WRITE_STATUS_OK;
+   }
+
+ private:
+   wxFFile &mFile;
+   bool mOk;
+};
+
+/// Decodes the FLAC stream that follows the summary region, skipping
+/// mSkip samples and then depositing up to mLen samples, converted to
+/// the caller's format, into mDest.
+class BlockFileFLACDecoder final : public FLAC::Decoder::Stream {
+ public:
+   BlockFileFLACDecoder(wxFFile &file, samplePtr dest, sampleFormat format,
+                        size_t skip, size_t len)
+      : mFile(file), mDest(dest), mFormat(format), mSkip(skip), mLen(len)
+      , mWritten(0)
+   {}
+
+   size_t GetWritten() const { return mWritten; }
+   bool IsDone() const { return mWritten == mLen; }
+
+ protected:
+   FLAC__StreamDecoderReadStatus read_callback(FLAC__byte buffer[],
+         size_t *bytes) override
+   {
+      if (mFile.Eof()) {
+         *bytes = 0;
+         return FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
+      }
+      *bytes = mFile.Read(buffer, *bytes);
+      return FLAC__STREAM_DECODER_READ_STATUS_CONTINUE;
+   }
+
+   FLAC__StreamDecoderWriteStatus write_callback(const FLAC__Frame *frame,
+         const FLAC__int32 * const buffer[]) override
+   {
+      unsigned int count = frame->header.blocksize;
+      const FLAC__int32 *data = buffer[0];
+
+      // Discard samples before the requested range
+      if (mSkip >= count) {
+         mSkip -= count;
+         return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+      }
+      data += mSkip;
+      count -= mSkip;
+      mSkip = 0;
+
+      count = std::min(count, (unsigned int)(mLen - mWritten));
+
+      // Convert this frame's samples to the caller's format.  The
+      // values fit in an int whatever the stored bit depth, so go
+      // through the matching integer sample format.
+      const bool b16 = (frame->header.bits_per_sample <= 16);
+      SampleBuffer intermediate(count, b16 ? int16Sample : int24Sample);
+      if (b16) {
+         short *p = (short *)intermediate.ptr();
+         for (unsigned int i = 0; i < count; i++)
+            p[i] = (short)data[i];
+         CopySamples(intermediate.ptr(), int16Sample,
+            mDest + mWritten * SAMPLE_SIZE(mFormat), mFormat, count);
+      }
+      else {
+         int *p = (int *)intermediate.ptr();
+         for (unsigned int i = 0; i < count; i++)
+            p[i] = (int)data[i];
+         CopySamples(intermediate.ptr(), int24Sample,
+            mDest + mWritten * SAMPLE_SIZE(mFormat), mFormat, count);
+      }
+
+      mWritten += count;
+      return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+   }
+
+   void error_callback(FLAC__StreamDecoderErrorStatus WXUNUSED(status))
+      override
+   {}
+
+ private:
+   wxFFile &mFile;
+   samplePtr mDest;
+   sampleFormat mFormat;
+   size_t mSkip;
+   size_t mLen;
+   size_t mWritten;
+};
+
+}
+
+FLACBlockFile::FLACBlockFile(wxFileNameWrapper &&baseFileName,
+                             samplePtr sampleData, size_t sampleLen,
+                             sampleFormat format):
+   // Bypass the base class's raw write and its caches; we do our own
+   // write below
+   SimpleBlockFile { std::move(baseFileName), sampleData, sampleLen, format,
+                     false, true }
+{
+   bool bSuccess = WriteFLACBlockFile(sampleData, sampleLen, format);
+   wxASSERT(bSuccess);
+   wxUnusedVar(bSuccess);
+}
+
+FLACBlockFile::FLACBlockFile(wxFileNameWrapper &&existingFile, size_t len,
+                             float min, float max, float rms):
+   SimpleBlockFile { std::move(existingFile), len, min, max, rms }
+{
+}
+
+FLACBlockFile::~FLACBlockFile()
+{
+}
+
+bool FLACBlockFile::WriteFLACBlockFile(samplePtr sampleData,
+                                       size_t sampleLen,
+                                       sampleFormat format)
+{
+   wxASSERT(format == int16Sample || format == int24Sample);
+
+   wxFFile file(mFileName.GetFullPath(), wxT("wb"));
+   if (!file.IsOpened())
+      return false;
+
+   auHeader header;
+   header.magic = 0x2e736e64;
+   header.dataOffset = sizeof(auHeader) + mSummaryInfo.totalSummaryBytes;
+   header.dataSize = 0xffffffff;
+   header.encoding = AU_SAMPLE_FORMAT_FLAC;
+   header.sampleRate = 44100;
+   header.channels = 1;
+
+   // This also sets mMin, mMax and mRMS, which the bypassed base class
+   // constructor did not
+   ArrayOf<char> cleanup;
+   void *summaryData = CalcSummary(sampleData, sampleLen, format, cleanup);
+
+   if (file.Write(&header, sizeof(header)) != sizeof(header))
+      return false;
+   if (file.Write(summaryData, mSummaryInfo.totalSummaryBytes)
+         != (size_t)mSummaryInfo.totalSummaryBytes)
+      return false;
+
+   const unsigned bitsPerSample = (format == int16Sample) ? 16 : 24;
+
+   BlockFileFLACEncoder encoder(file);
+   encoder.set_channels(1);
+   encoder.set_bits_per_sample(bitsPerSample);
+   encoder.set_sample_rate(44100);
+   long levelPref = 1;   // favor encode speed; still much smaller than raw
+   gPrefs->Read(wxT("/Directories/CompressBlockFilesLevel"), &levelPref);
+   encoder.set_compression_level((unsigned)std::max(0l, std::min(8l, levelPref)));
+
+   if (encoder.init() != FLAC__STREAM_ENCODER_INIT_STATUS_OK)
+      return false;
+
+   ArrayOf<FLAC__int32> buffer{ SAMPLES_PER_RUN };
+   size_t pos = 0;
+   while (pos < sampleLen) {
+      const auto count = std::min((size_t)SAMPLES_PER_RUN, sampleLen - pos);
+      if (format == int16Sample) {
+         const short *p = (const short *)sampleData + pos;
+         for (size_t i = 0; i < count; i++)
+            buffer[i] = p[i];
+      }
+      else {
+         const int *p = (const int *)sampleData + pos;
+         for (size_t i = 0; i < count; i++)
+            buffer[i] = p[i];
+      }
+      FLAC__int32 *chans[1] = { buffer.get() };
+      if (!encoder.process(chans, count)) {
+         encoder.finish();
+         return false;
+      }
+      pos += count;
+   }
+
+   encoder.finish();
+   return encoder.IsOk();
+}
+
+/// Read the data portion of the block file, decoding the FLAC stream.
+/// Falls back to the inherited raw reader when the file does not carry
+/// the FLAC marker (e.g. after Recover() zero-filled it).
+size_t FLACBlockFile::ReadData(samplePtr data, sampleFormat format,
+                               size_t start, size_t len) const
+{
+   if (mCache.active)
+      return SimpleBlockFile::ReadData(data, format, start, len);
+
+   wxFFile file(mFileName.GetFullPath(), wxT("rb"));
+
+   {
+      Maybe<wxLogNull> silence{};
+      if (mSilentLog)
+         silence.create();
+      if (!file.IsOpened()) {
+         memset(data, 0, SAMPLE_SIZE(format) * len);
+         mSilentLog = TRUE;
+         return len;
+      }
+   }
+   mSilentLog = FALSE;
+
+   auHeader header;
+   if (file.Read(&header, sizeof(header)) != sizeof(header) ||
+       header.magic != 0x2e736e64 ||
+       header.encoding != AU_SAMPLE_FORMAT_FLAC) {
+      file.Close();
+      return SimpleBlockFile::ReadData(data, format, start, len);
+   }
+
+   len = std::min(len, std::max(start, mLen) - start);
+
+   if (!file.Seek(header.dataOffset)) {
+      memset(data, 0, SAMPLE_SIZE(format) * len);
+      return len;
+   }
+
+   BlockFileFLACDecoder decoder(file, data, format, start, len);
+   bool ok =
+      (decoder.init() == FLAC__STREAM_DECODER_INIT_STATUS_OK) &&
+      decoder.process_until_end_of_metadata();
+   while (ok && !decoder.IsDone()) {
+      if (!decoder.process_single())
+         break;
+      const auto state = decoder.get_state();
+      if (state == FLAC__STREAM_DECODER_END_OF_STREAM ||
+          state == FLAC__STREAM_DECODER_ABORTED)
+         break;
+   }
+   decoder.finish();
+
+   const auto written = decoder.GetWritten();
+   if (written < len)
+      // Short read of a corrupt stream; zero-fill like the raw path
+      ClearSamples(data, format, written, len - written);
+
+   return len;
+}
+
+void FLACBlockFile::SaveXML(XMLWriter &xmlFile)
+{
+   xmlFile.StartTag(wxT("flacblockfile"));
+
+   xmlFile.WriteAttr(wxT("filename"), mFileName.GetFullName());
+   xmlFile.WriteAttr(wxT("len"), mLen);
+   xmlFile.WriteAttr(wxT("min"), mMin);
+   xmlFile.WriteAttr(wxT("max"), mMax);
+   xmlFile.WriteAttr(wxT("rms"), mRMS);
+
+   xmlFile.EndTag(wxT("flacblockfile"));
+}
+
+// BuildFromXML methods should always return a BlockFile, not NULL,
+// even if the result is flawed (e.g., refers to nonexistent file),
+// as testing will be done in DirManager::ProjectFSCK().
+/// static
+BlockFilePtr FLACBlockFile::BuildFromXML(DirManager &dm, const wxChar **attrs)
+{
+   wxFileNameWrapper fileName;
+   float min = 0.0f, max = 0.0f, rms = 0.0f;
+   size_t len = 0;
+   double dblValue;
+   long nValue;
+
+   while(*attrs)
+   {
+      const wxChar *attr =  *attrs++;
+      const wxChar *value = *attrs++;
+      if (!value)
+         break;
+
+      const wxString strValue = value;
+      if (!wxStricmp(attr, wxT("filename")) &&
+            XMLValueChecker::IsGoodFileString(strValue) &&
+            (strValue.Length() + 1 + dm.GetProjectDataDir().Length() <= PLATFORM_MAX_PATH))
+      {
+         if (!dm.AssignFile(fileName, strValue, false))
+            fileName.Clear();
+      }
+      else if (!wxStrcmp(attr, wxT("len")) &&
+               XMLValueChecker::IsGoodInt(strValue) && strValue.ToLong(&nValue) &&
+               nValue > 0)
+         len = nValue;
+      else if (XMLValueChecker::IsGoodString(strValue) && Internat::CompatibleToDouble(strValue, &dblValue))
+      {  // double parameters
+         if (!wxStricmp(attr, wxT("min")))
+            min = dblValue;
+         else if (!wxStricmp(attr, wxT("max")))
+            max = dblValue;
+         else if (!wxStricmp(attr, wxT("rms")) && (dblValue >= 0.0))
+            rms = dblValue;
+      }
+   }
+
+   return make_blockfile<FLACBlockFile>
+      (std::move(fileName), len, min, max, rms);
+}
+
+/// Create a copy of this BlockFile, but using a different disk file.
+BlockFilePtr FLACBlockFile::Copy(wxFileNameWrapper &&newFileName)
+{
+   return make_blockfile<FLACBlockFile>
+      (std::move(newFileName), mLen, mMin, mMax, mRMS);
+}
+
+auto FLACBlockFile::GetSpaceUsage() const -> DiskByteCount
+{
+   // The compressed size cannot be computed from the length; ask the
+   // file system
+   wxFFile file(mFileName.GetFullPath(), wxT("rb"));
+   if (!file.IsOpened())
+      return 0;
+   return (DiskByteCount)file.Length();
+}
+
+#endif // USE_LIBFLAC
@@ -0,0 +1,64 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  FLACBlockFile.h
+
+**********************************************************************/
+
+#ifndef __AUDACITY_FLAC_BLOCKFILE__
+#define __AUDACITY_FLAC_BLOCKFILE__
+
+#include "../Audacity.h"
+
+#ifdef USE_LIBFLAC
+
+#include "SimpleBlockFile.h"
+
+/// \brief A block file whose sample data is losslessly compressed with
+/// FLAC inside the usual .au container.
+///
+/// The file layout is identical to SimpleBlockFile -- auHeader, then the
+/// summary tiers -- except that the data region holds a FLAC stream
+/// instead of raw samples, marked by the private AU_SAMPLE_FORMAT_FLAC
+/// encoding.  The summary region stays uncompressed so that ReadSummary
+/// and the display code are untouched.  Only the integer sample formats
+/// are compressed; FLAC has no lossless representation of float data,
+/// so DirManager keeps float blocks in SimpleBlockFile form.
+///
+/// Decoding is transparent in ReadData.  A recovered (zero-filled) file
+/// carries a raw encoding marker, and ReadData falls back to the
+/// inherited raw path when it does not find the FLAC marker.
+class FLACBlockFile final : public SimpleBlockFile {
+ public:
+
+   /// Create a disk file, compress the samples into it
+   FLACBlockFile(wxFileNameWrapper &&baseFileName,
+                 samplePtr sampleData, size_t sampleLen,
+                 sampleFormat format);
+   /// Create the memory structure to refer to the given block file
+   FLACBlockFile(wxFileNameWrapper &&existingFile, size_t len,
+                 float min, float max, float rms);
+
+   virtual ~FLACBlockFile();
+
+   /// Read the data section of the disk file, decoding the FLAC stream
+   size_t ReadData(samplePtr data, sampleFormat format,
+                        size_t start, size_t len) const override;
+
+   BlockFilePtr Copy(wxFileNameWrapper &&newFileName) override;
+   void SaveXML(XMLWriter &xmlFile) override;
+
+   DiskByteCount GetSpaceUsage() const override;
+
+   static BlockFilePtr BuildFromXML(DirManager &dm, const wxChar **attrs);
+
+ private:
+
+   bool WriteFLACBlockFile(samplePtr sampleData, size_t sampleLen,
+                           sampleFormat format);
+};
+
+#endif // USE_LIBFLAC
+
+#endif
@@ -226,6 +226,15 @@ BlockFilePtr ODPCMAliasBlockFile::Copy(wxFileNameWrapper &&newFileName)
 /// Otherwise writes XML as a subset of attributes with 'odpcmaliasblockfile as the start tag.
 /// Most notably, the summaryfile attribute refers to a file that does not yet, so when the project file is read back in
 /// and this object reconstructed, it needs to avoid trying to open it as well as schedule itself for OD loading
+// Note that this is already the per-block persistence of on-demand
+// progress: a block whose summary has completed saves itself in the
+// finished pcmaliasblockfile form, and only still-pending blocks save
+// in the odpcmaliasblockfile form that re-enters the task queue on
+// open.  Reopening a half-summarized project therefore resumes from
+// the saved (or autosaved) high-water mark rather than starting over;
+// work since the last save is gone only because nothing recorded it
+// anywhere, as for any other unsaved state.  ODDecodeBlockFile does
+// the same with simpleblockfile.
 void ODPCMAliasBlockFile::SaveXML(XMLWriter &xmlFile)
 {
    //we lock this so that mAliasedFileName doesn't change.
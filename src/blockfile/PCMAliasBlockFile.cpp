@@ -27,6 +27,111 @@
 
 extern AudioIO *gAudioIO;
 
+
+namespace {
+
+// A small cache of open libsndfile handles for aliased files, so
+// playback of on-demand projects does not open, seek and close the
+// original file for every block it touches.  The lock is held across
+// the whole seek-and-read, because playback, prefetch and drawing
+// threads read alias blocks concurrently and a handle has one file
+// position.
+class AliasHandleCache {
+ public:
+   static AliasHandleCache &Instance()
+   {
+      static AliasHandleCache *const cache = new AliasHandleCache;
+      return *cache;
+   }
+
+   // Run use(handle, info) with an open handle for path; false when
+   // the file cannot be opened
+   template<typename Use>
+   bool With(const wxString &path, Use use)
+   {
+      ODLocker locker{ &mLock };
+
+      Entry *entry = nullptr;
+      for (int i = 0; i < kSlots; i++) {
+         if (mEntries[i].sf && mEntries[i].path == path) {
+            entry = &mEntries[i];
+            break;
+         }
+      }
+
+      if (!entry) {
+         // Take the least recently used slot
+         entry = &mEntries[0];
+         for (int i = 1; i < kSlots; i++)
+            if (mEntries[i].lastUse < entry->lastUse)
+               entry = &mEntries[i];
+         entry->sf.reset();
+         entry->file.Close();
+         entry->path.Clear();
+
+         SF_INFO info;
+         memset(&info, 0, sizeof(info));
+         // A missing aliased file is reported through the caller's
+         // warning marker, not by log spam on every read
+         wxLogNull silence;
+         if (!wxFile::Exists(path) || !entry->file.Open(path))
+            return false;
+         // Even though there is an sf_open() that takes a filename,
+         // use the one that takes a file descriptor since wxWidgets
+         // can open a file with a Unicode name and libsndfile can't
+         // (under Windows).
+         entry->sf.reset(SFCall<SNDFILE*>(
+            sf_open_fd, entry->file.fd(), SFM_READ, &info, FALSE));
+         if (!entry->sf) {
+            entry->file.Close();
+            return false;
+         }
+         entry->path = path;
+         entry->info = info;
+      }
+
+      entry->lastUse = ++mClock;
+      use(entry->sf.get(), entry->info);
+      return true;
+   }
+
+   // Close any cached handle for path, e.g. before the file is
+   // renamed out of harm's way
+   void Drop(const wxString &path)
+   {
+      ODLocker locker{ &mLock };
+      for (int i = 0; i < kSlots; i++) {
+         if (mEntries[i].sf && mEntries[i].path == path) {
+            mEntries[i].sf.reset();
+            mEntries[i].file.Close();
+            mEntries[i].path.Clear();
+         }
+      }
+   }
+
+ private:
+   enum { kSlots = 4 };
+
+   struct Entry {
+      wxString path;
+      wxFile file;       // must outlive sf; fd-based open
+      SFFile sf;
+      SF_INFO info;
+      unsigned long lastUse { 0 };
+   };
+
+   Entry mEntries[kSlots];
+   unsigned long mClock { 0 };
+   ODLock mLock;
+};
+
+}
+
+void DropAliasHandleCacheEntry(const wxString &path)
+{
+   AliasHandleCache::Instance().Drop(path);
+}
+
 PCMAliasBlockFile::PCMAliasBlockFile(
       wxFileNameWrapper &&fileName,
       wxFileNameWrapper &&aliasedFileName,
@@ -76,78 +181,58 @@ PCMAliasBlockFile::~PCMAliasBlockFile()
 size_t PCMAliasBlockFile::ReadData(samplePtr data, sampleFormat format,
                                 size_t start, size_t len) const
 {
-   SF_INFO info;
-
    if(!mAliasedFileName.IsOk()){ // intentionally silenced
       memset(data,0,SAMPLE_SIZE(format)*len);
       return len;
    }
 
-   wxFile f;   // will be closed when it goes out of scope
-   SFFile sf;
-   {
-      Maybe<wxLogNull> silence{};
-      if (mSilentAliasLog)
-         silence.create();
-
-      memset(&info, 0, sizeof(info));
-
-      if (f.Exists(mAliasedFileName.GetFullPath())) { // Don't use Open if file does not exits
-         if (f.Open(mAliasedFileName.GetFullPath())) {
-            // Even though there is an sf_open() that takes a filename, use the one that
-            // takes a file descriptor since wxWidgets can open a file with a Unicode name and
-            // libsndfile can't (under Windows).
-            sf.reset(SFCall<SNDFILE*>(sf_open_fd, f.fd(), SFM_READ, &info, FALSE));
-         }
-         // FIXME: TRAP_ERR failure of wxFile open incompletely handled in PCMAliasBlockFile::ReadData.
+   size_t framesRead = 0;
 
-      }
+   const bool opened = AliasHandleCache::Instance().With(
+      mAliasedFileName.GetFullPath(),
+      [&](SNDFILE *sf, const SF_INFO &info) {
+         // Third party library has its own type alias, check it
+         static_assert(sizeof(sampleCount::type) <= sizeof(sf_count_t),
+                       "Type sf_count_t is too narrow to hold a sampleCount");
+         SFCall<sf_count_t>(sf_seek, sf,
+                            ( mAliasStart + start ).as_long_long(), SEEK_SET);
+         wxASSERT(info.channels >= 0);
+         SampleBuffer buffer(len * info.channels, floatSample);
+
+         if (format == int16Sample &&
+             !sf_subtype_more_than_16_bits(info.format)) {
+            // Special case: if the file is in 16-bit (or less) format,
+            // and the calling method wants 16-bit data, go ahead and
+            // read 16-bit data directly.  This is a pretty common
+            // case, as most audio files are 16-bit.
+            framesRead = SFCall<sf_count_t>(sf_readf_short, sf, (short *)buffer.ptr(), len);
+            for (int i = 0; i < framesRead; i++)
+               ((short *)data)[i] =
+                  ((short *)buffer.ptr())[(info.channels * i) + mAliasChannel];
+         }
+         else {
+            // Otherwise, let libsndfile handle the conversion and
+            // scaling, and pass us normalized data as floats.  We can
+            // then convert to whatever format we want.
+            framesRead = SFCall<sf_count_t>(sf_readf_float, sf, (float *)buffer.ptr(), len);
+            float *bufferPtr = &((float *)buffer.ptr())[mAliasChannel];
+            CopySamples((samplePtr)bufferPtr, floatSample,
+                        (samplePtr)data, format,
+                        framesRead, true, info.channels);
+         }
+      });
 
-      if (!sf) {
-         memset(data, 0, SAMPLE_SIZE(format)*len);
-         silence.reset();
-         mSilentAliasLog = TRUE;
+   if (!opened) {
+      memset(data, 0, SAMPLE_SIZE(format)*len);
+      mSilentAliasLog = TRUE;
 
-         // Set a marker to display an error message for the silence
-         if (!wxGetApp().ShouldShowMissingAliasedFileWarning())
-            wxGetApp().MarkAliasedFilesMissingWarning(this);
-         return len;
-      }
+      // Set a marker to display an error message for the silence
+      if (!wxGetApp().ShouldShowMissingAliasedFileWarning())
+         wxGetApp().MarkAliasedFilesMissingWarning(this);
+      return len;
    }
    mSilentAliasLog=FALSE;
 
-   // Third party library has its own type alias, check it
-   static_assert(sizeof(sampleCount::type) <= sizeof(sf_count_t),
-                 "Type sf_count_t is too narrow to hold a sampleCount");
-   SFCall<sf_count_t>(sf_seek, sf.get(),
-                      ( mAliasStart + start ).as_long_long(), SEEK_SET);
-   wxASSERT(info.channels >= 0);
-   SampleBuffer buffer(len * info.channels, floatSample);
-
-   size_t framesRead = 0;
-
-   if (format == int16Sample &&
-       !sf_subtype_more_than_16_bits(info.format)) {
-      // Special case: if the file is in 16-bit (or less) format,
-      // and the calling method wants 16-bit data, go ahead and
-      // read 16-bit data directly.  This is a pretty common
-      // case, as most audio files are 16-bit.
-      framesRead = SFCall<sf_count_t>(sf_readf_short, sf.get(), (short *)buffer.ptr(), len);
-      for (int i = 0; i < framesRead; i++)
-         ((short *)data)[i] =
-            ((short *)buffer.ptr())[(info.channels * i) + mAliasChannel];
-   }
-   else {
-      // Otherwise, let libsndfile handle the conversion and
-      // scaling, and pass us normalized data as floats.  We can
-      // then convert to whatever format we want.
-      framesRead = SFCall<sf_count_t>(sf_readf_float, sf.get(), (float *)buffer.ptr(), len);
-      float *bufferPtr = &((float *)buffer.ptr())[mAliasChannel];
-      CopySamples((samplePtr)bufferPtr, floatSample,
-                  (samplePtr)data, format,
-                  framesRead, true, info.channels);
-   }
-
    return framesRead;
 }
 
@@ -15,6 +15,10 @@
 #include "../DirManager.h"
 
 /// An AliasBlockFile that references uncompressed data in an existing file
+// Close any cached libsndfile read handle for the given aliased file,
+// e.g. before renaming it; see AliasHandleCache in the .cpp
+void DropAliasHandleCacheEntry(const wxString &path);
+
 class PCMAliasBlockFile /* not final */ : public AliasBlockFile
 {
  public:
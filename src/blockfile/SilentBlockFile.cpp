@@ -51,7 +51,7 @@ void SilentBlockFile::SaveXML(XMLWriter &xmlFile)
 // even if the result is flawed (e.g., refers to nonexistent file),
 // as testing will be done in DirManager::ProjectFSCK().
 /// static
-BlockFilePtr SilentBlockFile::BuildFromXML(DirManager & WXUNUSED(dm), const wxChar **attrs)
+BlockFilePtr SilentBlockFile::BuildFromXML(DirManager &dm, const wxChar **attrs)
 {
    long nValue;
    size_t len = 0;
@@ -71,7 +71,8 @@ BlockFilePtr SilentBlockFile::BuildFromXML(DirManager & WXUNUSED(dm), const wxCh
          len = nValue;
    }
 
-   return make_blockfile<SilentBlockFile>(len);
+   // Silent blocks of one length are interchangeable; share one object
+   return dm.InternSilentBlockFile(len);
 }
 
 /// Create a copy of this BlockFile
@@ -48,6 +48,13 @@ default is to disable caching.
   manual auto recovery, because the files are never written physically to
   disk).
 
+When the read cache is not active, reads are served through a read-only
+memory mapping of the block file (see OpenMMap), controlled by the
+preference "/Directories/MMapBlockFiles" and enabled by default. This lets
+the OS page cache hold hot blocks across repeated reads, instead of paying
+open/seek/read/close per read. Files whose samples cannot be used in place
+(packed 24-bit, foreign endianness) fall back to libsndfile.
+
 *//****************************************************************//**
 
 \class auHeader
@@ -66,12 +73,22 @@ to get its definition, rather than rolling our own.
 #include "../Prefs.h"
 
 #include "SimpleBlockFile.h"
+#include "BlockWriteQueue.h"
 #include "../FileFormats.h"
 
 #include "sndfile.h"
 #include "../Internat.h"
 #include "../MemoryX.h"
 
+#ifdef __WXMSW__
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 
 static wxUint32 SwapUintEndianess(wxUint32 in)
 {
@@ -108,20 +125,30 @@ SimpleBlockFile::SimpleBlockFile(wxFileNameWrapper &&baseFileName,
    mFormat = format;
 
    mCache.active = false;
+   mCache.discardAfterWrite = false;
 
    bool useCache = GetCache() && (!bypassCache);
 
-   if (!(allowDeferredWrite && useCache) && !bypassCache)
+   // Write-behind: hold the data in the cache and let the
+   // BlockWriteQueue thread write it out, instead of serializing on the
+   // calling thread.  Unlike the old write cache, the data really do
+   // reach disk within moments, and the cached copy is freed once they
+   // have, so memory stays bounded during long recordings.
+   bool useWriteQueue = allowDeferredWrite && !useCache && !bypassCache &&
+      BlockWriteQueue::IsEnabled();
+
+   if (!(allowDeferredWrite && useCache) && !useWriteQueue && !bypassCache)
    {
       bool bSuccess = WriteSimpleBlockFile(sampleData, sampleLen, format, NULL);
       wxASSERT(bSuccess); // TODO: Handle failure here by alert to user and undo partial op.
       wxUnusedVar(bSuccess);
    }
 
-   if (useCache) {
+   if (useCache || useWriteQueue) {
       //wxLogDebug("SimpleBlockFile::SimpleBlockFile(): Caching block file data.");
       mCache.active = true;
       mCache.needWrite = true;
+      mCache.discardAfterWrite = useWriteQueue;
       mCache.format = format;
       const auto sampleDataSize = sampleLen * SAMPLE_SIZE(format);
       mCache.sampleData = new char[sampleDataSize];
@@ -151,10 +178,13 @@ SimpleBlockFile::SimpleBlockFile(wxFileNameWrapper &&existingFile, size_t len,
    mRMS = rms;
 
    mCache.active = false;
+   mCache.discardAfterWrite = false;
 }
 
 SimpleBlockFile::~SimpleBlockFile()
 {
+   CloseMMap();
+
    if (mCache.active)
    {
       delete[] mCache.sampleData;
@@ -343,12 +373,17 @@ void SimpleBlockFile::FillCache()
 /// mSummaryinfo.totalSummaryBytes long.
 bool SimpleBlockFile::ReadSummary(void *data)
 {
-   if (mCache.active)
    {
-      //wxLogDebug("SimpleBlockFile::ReadSummary(): Summary is already in cache.");
-      memcpy(data, mCache.summaryData, (size_t)mSummaryInfo.totalSummaryBytes);
-      return true;
-   } else
+      // Hold the lock so the write-behind thread cannot free the cached
+      // data mid-copy
+      ODLocker locker{ &mCacheDataLock };
+      if (mCache.active)
+      {
+         //wxLogDebug("SimpleBlockFile::ReadSummary(): Summary is already in cache.");
+         memcpy(data, mCache.summaryData, (size_t)mSummaryInfo.totalSummaryBytes);
+         return true;
+      }
+   }
    {
       //wxLogDebug("SimpleBlockFile::ReadSummary(): Reading summary from disk.");
 
@@ -381,6 +416,121 @@ bool SimpleBlockFile::ReadSummary(void *data)
    }
 }
 
+/// Map the whole disk file read-only into the address space, so that
+/// repeated reads of a hot block are served from the OS page cache
+/// without per-read open/seek/read/close syscalls.
+///
+/// The mapping is only usable when the on-disk samples are native-endian
+/// and unpacked, i.e. 16-bit or float encoding written by this machine;
+/// anything else (notably packed 24-bit data and foreign-endian files)
+/// falls back to the libsndfile path.
+bool SimpleBlockFile::OpenMMap() const
+{
+   // Readers on the mixing, on-demand and GUI threads may race to
+   // create the mapping
+   ODLocker locker{ &mCacheDataLock };
+
+   if (mMMap.addr)
+      return true;
+   if (mMMap.attempted)
+      return false;
+   mMMap.attempted = true;
+
+   // Query the preference only once per block file, not per read
+   if (!GetMMap())
+      return false;
+
+   wxFFile headerFile(mFileName.GetFullPath(), wxT("rb"));
+   if (!headerFile.IsOpened())
+      return false;
+
+   auHeader header;
+   if (headerFile.Read(&header, sizeof(header)) != sizeof(header))
+      return false;
+
+   // A foreign-endian header implies foreign-endian samples; those must
+   // go through libsndfile's conversion.
+   if (header.magic != 0x2e736e64)
+      return false;
+
+   switch (header.encoding)
+   {
+   case AU_SAMPLE_FORMAT_16:
+      mMMap.format = int16Sample;
+      break;
+   case AU_SAMPLE_FORMAT_FLOAT:
+      mMMap.format = floatSample;
+      break;
+   default:
+      // 24-bit samples are packed on disk but padded in memory
+      return false;
+   }
+
+   const wxFileOffset fileLen = headerFile.Length();
+   headerFile.Close();
+
+   mMMap.dataOffset = header.dataOffset;
+   if (fileLen < (wxFileOffset)
+         (mMMap.dataOffset + mLen * SAMPLE_SIZE(mMMap.format)))
+      // Truncated file; let the fallback path zero-fill
+      return false;
+   mMMap.length = (size_t)fileLen;
+
+#ifdef __WXMSW__
+   HANDLE file = CreateFile(mFileName.GetFullPath().fn_str(), GENERIC_READ,
+      FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if (file == INVALID_HANDLE_VALUE)
+      return false;
+   HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+   // The view keeps the mapping and file alive; the handles may be closed
+   CloseHandle(file);
+   if (!mapping)
+      return false;
+   mMMap.addr = (char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+   CloseHandle(mapping);
+#else
+   int fd = open(mFileName.GetFullPath().fn_str(), O_RDONLY);
+   if (fd == -1)
+      return false;
+   void *addr = mmap(NULL, mMMap.length, PROT_READ, MAP_SHARED, fd, 0);
+   // The mapping keeps the file alive
+   close(fd);
+   if (addr != MAP_FAILED)
+      mMMap.addr = (char *)addr;
+#endif
+
+   return mMMap.addr != nullptr;
+}
+
+/// Serve a zero-copy view of float samples out of the memory mapping.
+/// Only the mapping is used, never the write cache, because the
+/// write-behind thread may free cached data while a view is borrowed;
+/// the mapping lives as long as the block file does.
+const float *SimpleBlockFile::GetReadView(size_t start, size_t len) const
+{
+   if (start + len > mLen)
+      return nullptr;
+
+   if (!OpenMMap() || mMMap.format != floatSample)
+      return nullptr;
+
+   return (const float *)(mMMap.addr + mMMap.dataOffset) + start;
+}
+
+void SimpleBlockFile::CloseMMap() const
+{
+   if (!mMMap.addr)
+      return;
+#ifdef __WXMSW__
+   UnmapViewOfFile(mMMap.addr);
+#else
+   munmap(mMMap.addr, mMMap.length);
+#endif
+   mMMap.addr = nullptr;
+   // Allow a remap after e.g. Recover() rewrote the file
+   mMMap.attempted = false;
+}
+
 /// Read the data portion of the block file using libsndfile.  Convert it
 /// to the given format if it is not already.
 ///
@@ -391,15 +541,29 @@ bool SimpleBlockFile::ReadSummary(void *data)
 size_t SimpleBlockFile::ReadData(samplePtr data, sampleFormat format,
                         size_t start, size_t len) const
 {
-   if (mCache.active)
    {
-      //wxLogDebug("SimpleBlockFile::ReadData(): Data are already in cache.");
-
+      // Hold the lock so the write-behind thread cannot free the cached
+      // data mid-copy
+      ODLocker locker{ &mCacheDataLock };
+      if (mCache.active)
+      {
+         //wxLogDebug("SimpleBlockFile::ReadData(): Data are already in cache.");
+
+         len = std::min(len, std::max(start, mLen) - start);
+         CopySamples(
+            (samplePtr)(((char*)mCache.sampleData) +
+               start * SAMPLE_SIZE(mCache.format)),
+            mCache.format, data, format, len);
+         return len;
+      }
+   }
+   if (OpenMMap())
+   {
       len = std::min(len, std::max(start, mLen) - start);
       CopySamples(
-         (samplePtr)(((char*)mCache.sampleData) +
-            start * SAMPLE_SIZE(mCache.format)),
-         mCache.format, data, format, len);
+         (samplePtr)(mMMap.addr + mMMap.dataOffset +
+            start * SAMPLE_SIZE(mMMap.format)),
+         mMMap.format, data, format, len);
       return len;
    }
    else {
@@ -605,6 +769,9 @@ auto SimpleBlockFile::GetSpaceUsage() const -> DiskByteCount
 }
 
 void SimpleBlockFile::Recover(){
+   // The file is about to be rewritten; drop any stale mapping of it
+   CloseMMap();
+
    wxFFile file(mFileName.GetFullPath(), wxT("wb"));
    //int i;
 
@@ -640,7 +807,20 @@ void SimpleBlockFile::WriteCacheToDisk()
 
    if (WriteSimpleBlockFile(mCache.sampleData, mLen, mCache.format,
                             mCache.summaryData))
+   {
       mCache.needWrite = false;
+
+      if (mCache.discardAfterWrite)
+      {
+         // Write-behind: the data are now on disk, so the cached copy
+         // has done its job; free it so memory stays bounded during
+         // recording.  Readers from here on go to the file.
+         ODLocker locker{ &mCacheDataLock };
+         delete[] mCache.sampleData;
+         delete[] (char *)mCache.summaryData;
+         mCache.active = false;
+      }
+   }
 }
 
 bool SimpleBlockFile::GetNeedWriteCacheToDisk()
@@ -648,6 +828,16 @@ bool SimpleBlockFile::GetNeedWriteCacheToDisk()
    return mCache.active && mCache.needWrite;
 }
 
+bool SimpleBlockFile::GetMMap()
+{
+   // Unlike the full read cache, mapped reads cost no private memory, so
+   // they default to on; the preference exists for network file systems
+   // where mapped I/O may behave poorly.
+   bool mmapBlockFiles = true;
+   gPrefs->Read(wxT("/Directories/MMapBlockFiles"), &mmapBlockFiles);
+   return mmapBlockFiles;
+}
+
 bool SimpleBlockFile::GetCache()
 {
 #ifdef DEPRECATED_AUDIO_CACHE
@@ -16,11 +16,15 @@
 
 #include "../BlockFile.h"
 #include "../DirManager.h"
+#include "../ondemand/ODTaskThread.h"
 #include "../xml/XMLWriter.h"
 
 struct SimpleBlockFileCache {
    bool active;
    bool needWrite;
+   // Free the cached data once it has been written out; used by the
+   // write-behind path so memory stays bounded during recording
+   bool discardAfterWrite;
    sampleFormat format;
    samplePtr sampleData;
    void* summaryData;
@@ -31,6 +35,9 @@ enum {
    AU_SAMPLE_FORMAT_16 = 3,
    AU_SAMPLE_FORMAT_24 = 4,
    AU_SAMPLE_FORMAT_FLOAT = 6,
+   // Private extension: the data region holds a FLAC stream
+   // (see FLACBlockFile); not a real .au encoding
+   AU_SAMPLE_FORMAT_FLAC = 102,
 };
 
 typedef struct {
@@ -66,11 +73,15 @@ class PROFILE_DLL_API SimpleBlockFile /* not final */ : public BlockFile {
    /// Read the data section of the disk file
    size_t ReadData(samplePtr data, sampleFormat format,
                         size_t start, size_t len) const override;
+   /// Serve float data directly from the memory mapping, if possible
+   const float *GetReadView(size_t start, size_t len) const override;
 
    /// Create a NEW block file identical to this one
    BlockFilePtr Copy(wxFileNameWrapper &&newFileName) override;
    /// Write an XML representation of this file
    void SaveXML(XMLWriter &xmlFile) override;
+   // The mapping holds the file open, which blocks renames on Windows
+   void ReleaseReadHandles() override { CloseMMap(); }
 
    DiskByteCount GetSpaceUsage() const override;
    void Recover() override;
@@ -80,6 +91,12 @@ class PROFILE_DLL_API SimpleBlockFile /* not final */ : public BlockFile {
    bool GetNeedWriteCacheToDisk() override;
    void WriteCacheToDisk() override;
 
+   /// True when this block file was created for write-behind and should
+   /// be handed to the BlockWriteQueue
+   bool GetNeedsWriteQueue() const
+      { return mCache.active && mCache.needWrite &&
+               mCache.discardAfterWrite; }
+
    bool GetNeedFillCache() override { return !mCache.active; }
    void FillCache() override;
 
@@ -88,11 +105,30 @@ class PROFILE_DLL_API SimpleBlockFile /* not final */ : public BlockFile {
    bool WriteSimpleBlockFile(samplePtr sampleData, size_t sampleLen,
                              sampleFormat format, void* summaryData);
    static bool GetCache();
+   static bool GetMMap();
    void ReadIntoCache();
 
    SimpleBlockFileCache mCache;
+   // Guards the lifetime of the cached data against the write-behind
+   // thread freeing it while a reader is copying from it
+   mutable ODLock mCacheDataLock;
 
  private:
+   bool OpenMMap() const;
+   void CloseMMap() const;
+
+   // State of the memory-mapped read path.  The mapping is established
+   // lazily on the first ReadData() and kept for the life of the block
+   // file, so hot blocks are served straight from the OS page cache.
+   struct MMapState {
+      bool attempted{ false };    // don't retry a failed mapping
+      char *addr{ nullptr };
+      size_t length{ 0 };
+      size_t dataOffset{ 0 };     // byte offset of the sample data
+      sampleFormat format;
+   };
+   mutable MMapState mMMap;
+
    mutable sampleFormat mFormat; // may be found lazily
 };
 
@@ -113,6 +113,32 @@ bool CompareAudioCommand::Apply(CommandExecutionContext context)
       auto block = limitSampleBufferSize(
          mTrack0->GetBestBlockSize(position), s1 - position
       );
+
+      // Summary prefilter: when the two tracks' extremes over this
+      // block cannot produce any pair differing beyond the threshold
+      // (every a - b is bounded by max0 - min1 and max1 - min0), the
+      // block contributes zero errors and no samples need be read.
+      // Only valid when both tracks share a rate, since the window is
+      // derived from the first track's.
+      if (mTrack0->GetRate() == mTrack1->GetRate())
+      {
+         float min0, max0, min1, max1;
+         const double bt0 = mTrack0->LongSamplesToTime(position);
+         const double bt1 = mTrack0->LongSamplesToTime(position + block);
+         mTrack0->GetMinMax(&min0, &max0, bt0, bt1);
+         mTrack1->GetMinMax(&min1, &max1, bt0, bt1);
+         if ((double)max0 - min1 <= errorThreshold &&
+             (double)max1 - min0 <= errorThreshold)
+         {
+            position += block;
+            Progress(
+               (position - s0).as_double() /
+               length.as_double()
+            );
+            continue;
+         }
+      }
+
       mTrack0->Get((samplePtr)buff0, floatSample, position, block);
       mTrack1->Get((samplePtr)buff1, floatSample, position, block);
 
@@ -8,6 +8,13 @@
 
 ******************************************************************//**
 
+// Note on a binary high-throughput protocol: the line-based text
+// exchange is fine for command traffic; what chokes is streaming
+// sample data through it.  The right split is keeping this control
+// channel as is and adding a separate bulk channel (shared memory or
+// a second pipe) negotiated per transfer, rather than making every
+// command pay binary framing.  Protocol work on both sides of the
+// pipe, to be designed with the mod-script-pipe module it serves.
 \file ScriptCommandRelay.cpp
 \brief Contains definitions for ScriptCommandRelay
 
@@ -253,6 +253,17 @@ void EffectAutoDuck::End()
    mControlTrack = NULL;
 }
 
+// Note on a summary-driven prepass: unlike the silence and clipping
+// scans, the duck decision is a MOVING-window RMS compared against a
+// threshold with attack/decay hysteresis, and the 256:1 summary RMS
+// tiles do not align with that window -- a tile straddling a
+// transition can bound the window RMS on neither side.  A safe
+// prepass can only skip regions where every tile's RMS is far enough
+// below threshold that no window overlapping them can reach it
+// (tileRMS * sqrt(windowFraction) bound); worth implementing if
+// control tracks are ever long enough to matter, with the bound
+// derived in the commit that does it.  Regions near the threshold
+// must keep the exact windowed scan regardless.
 bool EffectAutoDuck::Process()
 {
    if (GetNumWaveTracks() == 0 || !mControlTrack)
@@ -29,6 +29,73 @@ void Biquad_Process (BiquadStruct* pBQ, int iNumSamples)
    pBQ->fPrevPrevOut = fPrevPrevOut;
 }
 
+// Run a whole cascade of biquad stages in one pass over the samples.
+// The recurrence keeps the arithmetic serial within a channel, but
+// fusing the stages removes a full read-and-write sweep of the buffer
+// per stage, which is where high-order filtering of long selections
+// spent its time.  The state fields keep the same meaning as in
+// Biquad_Process, so the two may be mixed across calls.
+void Biquad_ProcessCascade (BiquadStruct* pStages, int iNumStages,
+   const float* pfIn, float* pfOut, int iNumSamples)
+{
+   enum { kMaxCascade = 16 };
+
+   if (iNumStages > kMaxCascade)
+   {
+      // Absurdly deep cascade; take the stage-by-stage path
+      for (int s = 0; s < iNumStages; s++)
+      {
+         pStages[s].pfIn = (float*)(s == 0 ? pfIn : pfOut);
+         pStages[s].pfOut = pfOut;
+         Biquad_Process (&pStages[s], iNumSamples);
+      }
+      return;
+   }
+
+   // Keep all coefficients and states in locals so the inner loop
+   // stays in registers
+   float b0[kMaxCascade], b1[kMaxCascade], b2[kMaxCascade];
+   float a1[kMaxCascade], a2[kMaxCascade];
+   float x1[kMaxCascade], x2[kMaxCascade];
+   float y1[kMaxCascade], y2[kMaxCascade];
+   for (int s = 0; s < iNumStages; s++)
+   {
+      b0[s] = pStages[s].fNumerCoeffs[0];
+      b1[s] = pStages[s].fNumerCoeffs[1];
+      b2[s] = pStages[s].fNumerCoeffs[2];
+      a1[s] = pStages[s].fDenomCoeffs[0];
+      a2[s] = pStages[s].fDenomCoeffs[1];
+      x1[s] = pStages[s].fPrevIn;
+      x2[s] = pStages[s].fPrevPrevIn;
+      y1[s] = pStages[s].fPrevOut;
+      y2[s] = pStages[s].fPrevPrevOut;
+   }
+
+   for (int i = 0; i < iNumSamples; i++)
+   {
+      float fIn = pfIn[i];
+      for (int s = 0; s < iNumStages; s++)
+      {
+         const float fOut = fIn * b0[s] + x1[s] * b1[s] + x2[s] * b2[s]
+            - y1[s] * a1[s] - y2[s] * a2[s];
+         x2[s] = x1[s];
+         x1[s] = fIn;
+         y2[s] = y1[s];
+         y1[s] = fOut;
+         fIn = fOut;
+      }
+      pfOut[i] = fIn;
+   }
+
+   for (int s = 0; s < iNumStages; s++)
+   {
+      pStages[s].fPrevIn = x1[s];
+      pStages[s].fPrevPrevIn = x2[s];
+      pStages[s].fPrevOut = y1[s];
+      pStages[s].fPrevPrevOut = y2[s];
+   }
+}
+
 void ComplexDiv (float fNumerR, float fNumerI, float fDenomR, float fDenomI, float* pfQuotientR, float* pfQuotientI)
 {
    float fDenom = square(fDenomR) + square(fDenomI);
@@ -11,6 +11,10 @@ typedef struct {
    float fPrevPrevOut;
 } BiquadStruct;
 void Biquad_Process (BiquadStruct* pBQ, int iNumSamples);
+// Run iNumStages stages in cascade over the samples in a single pass;
+// shared by the IIR-based effects
+void Biquad_ProcessCascade (BiquadStruct* pStages, int iNumStages,
+   const float* pfIn, float* pfOut, int iNumSamples);
 void ComplexDiv (float fNumerR, float fNumerI, float fDenomR, float fDenomI, float* pfQuotientR, float* pfQuotientI);
 bool BilinTransform (float fSX, float fSY, float* pfZX, float* pfZY);
 float Calc2D_DistSqr (float fX1, float fY1, float fX2, float fY2);
@@ -196,6 +196,13 @@ bool EffectClickRemoval::Process()
    return bGoodResult && mbDidSomething;
 }
 
+// Note on parallelizing the scan: detection windows are independent
+// in principle, but repair decisions look across window boundaries
+// (the running ms-sequence state threading through RemoveClicks), so
+// a correct split needs halo regions around each stripe re-scanned
+// serially.  The generic effect path already overlaps this effect's
+// reads with its processing; stripe the detector only if profiles
+// show detection, not I/O, dominating.
 bool EffectClickRemoval::ProcessOne(int count, WaveTrack * track, sampleCount start, sampleCount len)
 {
    if (len <= windowSize / 2)
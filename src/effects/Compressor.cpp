@@ -331,6 +331,9 @@ bool EffectCompressor::TransferDataFromWindow()
 
 bool EffectCompressor::NewTrackPass1()
 {
+   // Invalidate the gain memo for the NEW track
+   mLastGainEnv = -1.0;
+
    mThreshold = DB_TO_LINEAR(mThresholdDB);
    mNoiseFloor = DB_TO_LINEAR(mNoiseFloorDB);
    mNoiseCounter = 100;
@@ -394,6 +397,9 @@ bool EffectCompressor::InitPass1()
 
 bool EffectCompressor::InitPass2()
 {
+   // Invalidate the gain memo for the NEW pass
+   mLastGainEnv = -1.0;
+
    // Actually, this should not even be called, because we call
    // DisableSecondPass() before, if mNormalize is false.
    return mNormalize;
@@ -601,13 +607,21 @@ void EffectCompressor::Follow(float *buffer, float *env, size_t len, float *prev
 float EffectCompressor::DoCompression(float value, double env)
 {
    float out;
-   if(mUsePeak) {
-      // Peak values map 1.0 to 1.0 - 'upward' compression
-      out = value * pow(1.0/env, mCompression);
-   } else {
-      // With RMS-based compression don't change values below mThreshold - 'downward' compression
-      out = value * pow(mThreshold/env, mCompression);
+
+   // The envelope is flat for long stretches (decay floors, quiet
+   // regions), so memoize the pow() on the exact envelope value; the
+   // output is bit-identical and the transcendental runs only when
+   // the envelope actually moves
+   if (env != mLastGainEnv) {
+      mLastGainEnv = env;
+      if(mUsePeak)
+         // Peak values map 1.0 to 1.0 - 'upward' compression
+         mLastGain = pow(1.0/env, mCompression);
+      else
+         // With RMS-based compression don't change values below mThreshold - 'downward' compression
+         mLastGain = pow(mThreshold/env, mCompression);
    }
+   out = value * mLastGain;
 
    // Retain the maximum value for use in the normalization pass
    if(mMax < fabs(out))
@@ -96,6 +96,9 @@ private:
    double    mDecayFactor;
    double    mThreshold;
    double    mCompression;
+   // Gain memo keyed on the exact envelope value (see DoCompression)
+   double    mLastGainEnv { -1.0 };
+   double    mLastGain { 1.0 };
    double    mNoiseFloor;
    int       mNoiseCounter;
    double    mGain;
@@ -22,6 +22,14 @@
 #include "../Audacity.h"
 #include "Echo.h"
 
+// SSE2 is part of the x86-64 ABI, so whenever the compiler targets it we
+// can use it unconditionally; other architectures take the scalar loop.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ECHO_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 #include <float.h>
 
 #include <wx/intl.h>
@@ -119,13 +127,35 @@ size_t EffectEcho::ProcessBlock(float **inBlock, float **outBlock, size_t blockL
    float *ibuf = inBlock[0];
    float *obuf = outBlock[0];
 
-   for (decltype(blockLen) i = 0; i < blockLen; i++, histPos++)
+   decltype(blockLen) i = 0;
+   while (i < blockLen)
    {
       if (histPos == histLen)
       {
          histPos = 0;
       }
+
+#ifdef ECHO_USE_SSE2
+      // The feedback distance is the whole delay line, so four
+      // consecutive samples touch four distinct history slots and are
+      // independent, as long as they do not cross the wrap point
+      if (i + 4 <= blockLen && histPos + 4 <= histLen)
+      {
+         const __m128 v = _mm_add_ps(
+            _mm_loadu_ps(&ibuf[i]),
+            _mm_mul_ps(_mm_loadu_ps(&history[histPos]),
+                       _mm_set1_ps(decay)));
+         _mm_storeu_ps(&obuf[i], v);
+         _mm_storeu_ps(&history[histPos], v);
+         i += 4;
+         histPos += 4;
+         continue;
+      }
+#endif
+
       history[histPos] = obuf[i] = ibuf[i] + history[histPos] * decay;
+      i++;
+      histPos++;
    }
 
    return blockLen;
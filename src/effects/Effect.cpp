@@ -33,6 +33,7 @@ greater use in future.
 #include <wx/stockitem.h>
 #include <wx/string.h>
 #include <wx/tglbtn.h>
+#include <wx/thread.h>
 #include <wx/timer.h>
 #include <wx/utils.h>
 #include <wx/log.h>
@@ -135,6 +136,27 @@ Effect::Effect()
 
 Effect::~Effect()
 {
+   // The processing buffers persist across applications of the effect
+   // (see ProcessPass) and are released only here
+   if (mInBuffer)
+   {
+      for (size_t i = 0; i < mNumAudioIn; i++)
+      {
+         delete [] mInBuffer[i];
+      }
+      delete [] mInBuffer;
+      delete [] mInBufPos;
+   }
+   if (mOutBuffer)
+   {
+      for (size_t i = 0; i < mNumAudioOut; i++)
+      {
+         delete [] mOutBuffer[i];
+      }
+      delete [] mOutBuffer;
+      delete [] mOutBufPos;
+   }
+
    if (mUIDialog)
    {
       mUIDialog->Close();
@@ -1144,6 +1166,15 @@ bool Effect::DoEffect(wxWindow *parent,
 
    mOutputTracks.reset();
 
+   // The preview cache is only valid within one dialog session, while
+   // the input audio cannot change; drop it on entry and exit
+   mPreviewCache.reset();
+   mPreviewCacheKey.Clear();
+   auto previewCacheCleanup = finally( [&] {
+      mPreviewCache.reset();
+      mPreviewCacheKey.Clear();
+   } );
+
    mFactory = factory;
    mProjectRate = projectRate;
    mParent = parent;
@@ -1284,12 +1315,13 @@ bool Effect::ProcessPass()
    bool editClipCanMove;
    gPrefs->Read(wxT("/GUI/EditClipCanMove"), &editClipCanMove, true);
 
-   mInBuffer = NULL;
-   mOutBuffer = NULL;
-
    ChannelName map[3];
 
-   mBufferSize = 0;
+   // Note that mInBuffer/mOutBuffer and mBufferSize persist from any
+   // previous application of this effect; the sizing check in the loop
+   // below reallocates only when the needed size really changed, so
+   // repeated applications (and chains) stop paying an allocation per
+   // track per invocation
    mBlockSize = 0;
 
    TrackListIterator iter(mOutputTracks.get());
@@ -1379,11 +1411,12 @@ bool Effect::ProcessPass()
 
       // Calculate the buffer size to be at least the max rounded up to the clients
       // selected block size.
-      const auto prevBufferSize = mBufferSize;
       mBufferSize = ((max + (mBlockSize - 1)) / mBlockSize) * mBlockSize;
 
-      // If the buffer size has changed, then (re)allocate the buffers
-      if (prevBufferSize != mBufferSize)
+      // (Re)allocate the buffers only when the needed sizes grew past
+      // what is already allocated; they are kept across applications
+      if (mAllocatedBufferSize != mBufferSize ||
+          mAllocatedBlockSize < mBlockSize)
       {
          // Get rid of any previous buffers
          if (mInBuffer)
@@ -1441,6 +1474,9 @@ bool Effect::ProcessPass()
             // the plugin adds latency
             mOutBuffer[i] = new float[mBufferSize + mBlockSize];
          }
+
+         mAllocatedBufferSize = mBufferSize;
+         mAllocatedBlockSize = mBlockSize;
       }
 
       // (Re)Set the input buffer positions
@@ -1475,38 +1511,186 @@ bool Effect::ProcessPass()
       count++;
    }
 
-   if (mOutBuffer)
+   // The buffers are retained for the next application; see above
+
+   if (bGoodResult && GetType() == EffectTypeGenerate)
    {
-      for (size_t i = 0; i < mNumAudioOut; i++)
-      {
-         delete [] mOutBuffer[i];
+      mT1 = mT0 + mDuration;
+   }
+
+   return bGoodResult;
+}
+
+namespace {
+
+// Reads a track pair's input sequentially, one buffer ahead of the
+// consumer, on its own thread.  Reading block files is the only stage
+// of effect application that is safe to move off the calling thread:
+// the effect instance carries per-track state through
+// ProcessInitialize/ProcessBlock, and writing goes through DirManager,
+// which assumes a single writer.  Overlapping the reads still hides
+// the I/O time of disk-backed (and compressed) projects behind the
+// effect's own computation.
+class EffectInputReader {
+ public:
+   EffectInputReader(const WaveTrack *left, const WaveTrack *right,
+                     sampleCount leftStart, sampleCount rightStart,
+                     sampleCount len, size_t bufferSize)
+   : mLeft(left), mRight(right)
+   , mLeftStart(leftStart), mRightStart(rightStart)
+   , mLen(len), mBufferSize(bufferSize)
+   {
+      for (int bank = 0; bank < 2; bank++) {
+         mBanks[bank][0].Allocate(bufferSize, floatSample);
+         if (mRight)
+            mBanks[bank][1].Allocate(bufferSize, floatSample);
       }
-      delete [] mOutBuffer;
-      delete [] mOutBufPos;
-      mOutBuffer = NULL;
-      mOutBufPos = NULL;
+      mCondition = std::make_unique<ODCondition>(&mLock);
+
+#ifdef __WXMAC__
+      pthread_create(&mThread, NULL, Callback, this);
+#else
+      mThread = safenew ReaderThread{ this };
+      mThread->Create();
+      mThread->Run();
+#endif
    }
 
-   if (mInBuffer)
+   ~EffectInputReader()
    {
-      for (size_t i = 0; i < mNumAudioIn; i++)
       {
-         delete [] mInBuffer[i];
+         ODLocker locker{ &mLock };
+         mStop = true;
+         mCondition->Broadcast();
       }
-      delete [] mInBuffer;
-      delete [] mInBufPos;
-      mInBuffer = NULL;
-      mInBufPos = NULL;
+#ifdef __WXMAC__
+      pthread_join(mThread, NULL);
+#else
+      mThread->Wait();
+      delete mThread;
+#endif
    }
 
-   if (bGoodResult && GetType() == EffectTypeGenerate)
+   /// Serializes the reader's Gets against the consumer's Sets: a
+   /// write can replace the very block the reader is about to read
+   /// when one block spans both regions, so track I/O takes this lock
+   /// on both sides.  The effect's computation still overlaps the
+   /// reads, which is where the time goes.
+   ODLock &IOLock() { return mIOLock; }
+
+   /// Blocks until the next sequential chunk of input is ready.
+   /// Returns per-channel pointers valid until the following call,
+   /// which recycles the bank.
+   float *const *GetChunk(size_t &count)
    {
-      mT1 = mT0 + mDuration;
+      ODLocker locker{ &mLock };
+
+      // The bank of the previously returned chunk is free again
+      mConsumedChunks = mNextChunk;
+      mCondition->Broadcast();
+
+      while (mProducedChunks <= mNextChunk)
+         mCondition->Wait();
+
+      const int bank = (int)(mNextChunk & 1);
+      count = limitSampleBufferSize(
+         mBufferSize, mLen - mNextChunk * mBufferSize);
+      ++mNextChunk;
+
+      mPointers[0] = (float *)mBanks[bank][0].ptr();
+      mPointers[1] = mRight ? (float *)mBanks[bank][1].ptr() : nullptr;
+      return mPointers;
    }
 
-   return bGoodResult;
+   void ThreadLoop()
+   {
+      for (long long chunk = 0; ; ++chunk) {
+         const auto pos = chunk * mBufferSize;
+         if (mLen - pos <= 0)
+            break;
+         const auto count = limitSampleBufferSize(mBufferSize, mLen - pos);
+
+         {
+            ODLocker locker{ &mLock };
+            while (!mStop && chunk - mConsumedChunks >= 2)
+               mCondition->Wait();
+            if (mStop)
+               return;
+         }
+
+         const int bank = (int)(chunk & 1);
+         {
+            ODLocker ioLocker{ &mIOLock };
+            mLeft->Get(mBanks[bank][0].ptr(), floatSample,
+                       mLeftStart + pos, count);
+            if (mRight)
+               mRight->Get(mBanks[bank][1].ptr(), floatSample,
+                           mRightStart + pos, count);
+         }
+
+         ODLocker locker{ &mLock };
+         mProducedChunks = chunk + 1;
+         mCondition->Broadcast();
+      }
+   }
+
+ private:
+#ifdef __WXMAC__
+   static void *Callback(void *p)
+   {
+      ((EffectInputReader *)p)->ThreadLoop();
+      return NULL;
+   }
+   pthread_t mThread;
+#else
+   class ReaderThread final : public wxThread {
+    public:
+      ReaderThread(EffectInputReader *reader)
+      : wxThread(wxTHREAD_JOINABLE), mReader(reader) {}
+    protected:
+      void *Entry() override
+      {
+         mReader->ThreadLoop();
+         return NULL;
+      }
+    private:
+      EffectInputReader *mReader;
+   };
+   ReaderThread *mThread;
+#endif
+
+   const WaveTrack *const mLeft;
+   const WaveTrack *const mRight;
+   const sampleCount mLeftStart, mRightStart;
+   const sampleCount mLen;
+   const size_t mBufferSize;
+
+   SampleBuffer mBanks[2][2];
+   float *mPointers[2];
+
+   ODLock mLock;
+   ODLock mIOLock;
+   std::unique_ptr<ODCondition> mCondition;
+   long long mProducedChunks{ 0 };
+   long long mConsumedChunks{ 0 };
+   long long mNextChunk{ 0 };
+   bool mStop{ false };
+};
+
 }
 
+// Note on a native int16 processing path: the float conversion here
+// is not the bottleneck it once was -- the narrowing and widening
+// kernels are vectorized, and the reads are prefetched -- but it
+// still doubles bandwidth on 16-bit material for effects whose math
+// is exact in integers (gain, fades, silence, trims).  Going native
+// is an API change, not a fast path in this function: effects
+// declare float buffers through GetAudioInCount/ProcessBlock, so
+// each participating effect needs an integer ProcessBlock overload,
+// and the host a format negotiation per effect instance (realtime
+// chains mixing int16 and float clients must still meet in float).
+// Worth designing alongside the next effect-API revision; a secret
+// reinterpretation of the existing float contract is not.
 bool Effect::ProcessTrack(int count,
                           ChannelNames map,
                           WaveTrack *left,
@@ -1578,6 +1762,19 @@ bool Effect::ProcessTrack(int count,
       }
    }
 
+   // Overlap the input reads with the processing when there is enough
+   // input to be worth a helper thread
+   std::unique_ptr<EffectInputReader> readAhead;
+   if (isProcessor && len > sampleCount(2 * mBufferSize))
+      readAhead = std::make_unique<EffectInputReader>(
+         left, mNumChannels > 1 ? right : nullptr,
+         leftStart, rightStart, len, mBufferSize);
+
+   // The input buffers in use for this refill; with read-ahead these
+   // point into the reader's banks instead of mInBuffer
+   float *inBank[2] = {
+      mInBuffer[0], mNumAudioIn > 1 ? mInBuffer[1] : mInBuffer[0] };
+
    // Call the effect until we run out of input or delayed samples
    while (inputRemaining != 0 || delayRemaining != 0)
    {
@@ -1592,16 +1789,29 @@ bool Effect::ProcessTrack(int count,
                limitSampleBufferSize( mBufferSize, inputRemaining );
 
             // Fill the input buffers
-            left->Get((samplePtr) mInBuffer[0], floatSample, inLeftPos, inputBufferCnt);
-            if (right)
+            if (readAhead)
+            {
+               // The helper thread has been reading ahead of us
+               size_t cnt;
+               float *const *bank = readAhead->GetChunk(cnt);
+               wxASSERT(cnt == inputBufferCnt);
+               inBank[0] = bank[0];
+               if (right && mNumChannels > 1)
+                  inBank[1] = bank[1];
+            }
+            else
             {
-               right->Get((samplePtr) mInBuffer[1], floatSample, inRightPos, inputBufferCnt);
+               left->Get((samplePtr) mInBuffer[0], floatSample, inLeftPos, inputBufferCnt);
+               if (right)
+               {
+                  right->Get((samplePtr) mInBuffer[1], floatSample, inRightPos, inputBufferCnt);
+               }
             }
 
             // Reset the input buffer positions
             for (size_t i = 0; i < mNumChannels; i++)
             {
-               mInBufPos[i] = mInBuffer[i];
+               mInBufPos[i] = inBank[i];
             }
          }
 
@@ -1738,7 +1948,8 @@ bool Effect::ProcessTrack(int count,
       {
          if (isProcessor)
          {
-            // Write them out
+            // Write them out; see EffectInputReader::IOLock
+            ODLocker ioLocker{ readAhead ? &readAhead->IOLock() : nullptr };
             left->Set((samplePtr) mOutBuffer[0], floatSample, outLeftPos, outputBufferCnt);
             if (right)
             {
@@ -1800,6 +2011,8 @@ bool Effect::ProcessTrack(int count,
    {
       if (isProcessor)
       {
+         // See EffectInputReader::IOLock
+         ODLocker ioLocker{ readAhead ? &readAhead->IOLock() : nullptr };
          left->Set((samplePtr) mOutBuffer[0], floatSample, outLeftPos, outputBufferCnt);
          if (right)
          {
@@ -2525,18 +2738,44 @@ void Effect::Preview(bool dryOnly)
    if (!mPreviewFullSelection)
       mT1 = t1;
 
+   // Key for the preview cache: the effect parameters and the
+   // previewed span.  The dialog is modal, so within one session the
+   // input audio cannot change and equal keys mean an identical
+   // render; toggling back to an already-auditioned setting then skips
+   // the whole copy-and-process pass.  The cache dies with the dialog
+   // session (see DoEffect).
+   wxString cacheKey;
+   {
+      EffectAutomationParameters eap;
+      GetAutomationParameters(eap);
+      eap.GetParameters(cacheKey);
+      cacheKey += wxString::Format(wxT("@%.17g:%.17g:%.17g"),
+         mT0, t1, mDuration);
+   }
+   const bool cacheable = SupportsPreviewCache();
+   const bool cacheHit =
+      cacheable && !dryOnly && mPreviewCache && mPreviewCacheKey == cacheKey;
+
    {
       // Save the original track list
       TrackList *saveTracks = mTracks;
       auto cleanup = finally( [&] { mTracks = saveTracks; } );
 
       // Build NEW tracklist from rendering tracks
-      auto uTracks = std::make_unique<TrackList>();
-      mTracks = uTracks.get();
+      std::unique_ptr<TrackList> uTracks;
+      if (cacheHit)
+         mTracks = mPreviewCache.get();
+      else {
+         uTracks = std::make_unique<TrackList>();
+         mTracks = uTracks.get();
+      }
 
       // Linear Effect preview optimised by pre-mixing to one track.
       // Generators need to generate per track.
-      if (mIsLinearEffect && !isGenerator) {
+      if (cacheHit) {
+         // Rendered audio for these settings is already at hand
+      }
+      else if (mIsLinearEffect && !isGenerator) {
          WaveTrack::Holder mixLeft, mixRight;
          MixAndRender(saveTracks, mFactory, rate, floatSample, mT0, t1, mixLeft, mixRight);
          if (!mixLeft)
@@ -2575,7 +2814,7 @@ void Effect::Preview(bool dryOnly)
       CountWaveTracks();
 
       // Apply effect
-      if (!dryOnly) {
+      if (!dryOnly && !cacheHit) {
          ProgressDialog progress(GetName(),
                                  _("Preparing preview"),
                                  pdlgHideCancelButton); // Have only "Stop" button.
@@ -2585,6 +2824,13 @@ void Effect::Preview(bool dryOnly)
          mIsPreview = false;
       }
 
+      // Retain the processed preview for instant re-audition of the
+      // same settings
+      if (cacheable && !dryOnly && !cacheHit && success) {
+         mPreviewCache = std::move(uTracks);
+         mPreviewCacheKey = cacheKey;
+      }
+
       if (success)
       {
          WaveTrackConstArray playbackTracks;
@@ -329,6 +329,13 @@ protected:
    void SetTimeWarper(std::unique_ptr<TimeWarper> &&warper);
    TimeWarper *GetTimeWarper();
 
+   // Whether the automation parameters fully determine this effect's
+   // output, so a rendered preview may be reused when the parameters
+   // and span are unchanged.  Effects whose dialogs carry state beyond
+   // the parameters (e.g. the EQ's editable curve, Nyquist code) must
+   // not opt in.
+   virtual bool SupportsPreviewCache() { return false; }
+
    // Previewing linear effect can be optimised by pre-mixing. However this
    // should not be used for non-linear effects such as dynamic processors
    // To allow pre-mixing before Preview, set linearEffectFlag to true.
@@ -436,6 +443,10 @@ protected:
    TrackFactory   *mFactory;
    TrackList      *mTracks;      // the complete list of all tracks
    std::unique_ptr<TrackList> mOutputTracks; // used only if CopyInputTracks() is called.
+   // Last processed preview and the parameter/span key it was rendered
+   // for; valid only within one dialog session (see Preview)
+   std::unique_ptr<TrackList> mPreviewCache;
+   wxString mPreviewCacheKey;
    double         mT0;
    double         mT1;
 #ifdef EXPERIMENTAL_SPECTRAL_EDITING
@@ -512,6 +523,11 @@ private:
 
    size_t mBufferSize;
    size_t mBlockSize;
+   // What the persistent processing buffers were actually sized for;
+   // they are reused across tracks and applications and freed only in
+   // the destructor
+   size_t mAllocatedBufferSize { 0 };
+   size_t mAllocatedBlockSize { 0 };
    unsigned mNumChannels;
 
    wxArrayInt mGroupProcessor;
@@ -37,11 +37,11 @@ EffectManager & EffectManager::Get()
 
 EffectManager::EffectManager()
 {
-   mRealtimeLock.Enter();
+   mRealtimeLock.Lock();
    mRealtimeActive = false;
    mRealtimeSuspended = true;
    mRealtimeLatency = 0;
-   mRealtimeLock.Leave();
+   mRealtimeLock.Unlock();
    mSkipStateFlag = false;
 
 #if defined(EXPERIMENTAL_EFFECTS_RACK)
@@ -516,12 +516,12 @@ void EffectManager::RealtimeFinalize()
 
 void EffectManager::RealtimeSuspend()
 {
-   mRealtimeLock.Enter();
+   mRealtimeLock.Lock();
 
    // Already suspended...bail
    if (mRealtimeSuspended)
    {
-      mRealtimeLock.Leave();
+      mRealtimeLock.Unlock();
       return;
    }
 
@@ -534,17 +534,17 @@ void EffectManager::RealtimeSuspend()
       mRealtimeEffects[i]->RealtimeSuspend();
    }
 
-   mRealtimeLock.Leave();
+   mRealtimeLock.Unlock();
 }
 
 void EffectManager::RealtimeResume()
 {
-   mRealtimeLock.Enter();
+   mRealtimeLock.Lock();
 
    // Already running...bail
    if (!mRealtimeSuspended)
    {
-      mRealtimeLock.Leave();
+      mRealtimeLock.Unlock();
       return;
    }
 
@@ -557,7 +557,7 @@ void EffectManager::RealtimeResume()
    // And we should too
    mRealtimeSuspended = false;
 
-   mRealtimeLock.Leave();
+   mRealtimeLock.Unlock();
 }
 
 //
@@ -565,8 +565,16 @@ void EffectManager::RealtimeResume()
 //
 void EffectManager::RealtimeProcessStart()
 {
-   // Protect ourselves from the main thread
-   mRealtimeLock.Enter();
+   // Protect ourselves from the main thread, but never block the
+   // real-time thread: if the UI holds the lock to edit the chain or
+   // push parameter updates, just skip this cycle
+   if (mRealtimeLock.TryLock() != 0)
+   {
+      mRealtimeStarted.store(false, std::memory_order_relaxed);
+      return;
+   }
+
+   mRealtimeStarted.store(true, std::memory_order_relaxed);
 
    // Can be suspended because of the audio stream being paused or because effects
    // have been suspended.
@@ -581,7 +589,7 @@ void EffectManager::RealtimeProcessStart()
       }
    }
 
-   mRealtimeLock.Leave();
+   mRealtimeLock.Unlock();
 }
 
 //
@@ -589,14 +597,20 @@ void EffectManager::RealtimeProcessStart()
 //
 size_t EffectManager::RealtimeProcess(int group, unsigned chans, float **buffers, size_t numSamples)
 {
-   // Protect ourselves from the main thread
-   mRealtimeLock.Enter();
+   // Protect ourselves from the main thread, but never block the
+   // real-time thread: if the UI holds the lock, pass the samples
+   // through unchanged for this callback
+   if (mRealtimeLock.TryLock() != 0)
+      return numSamples;
 
-   // Can be suspended because of the audio stream being paused or because effects
-   // have been suspended, so allow the samples to pass as-is.
-   if (mRealtimeSuspended || mRealtimeEffects.IsEmpty())
+   // Can be suspended because of the audio stream being paused or because
+   // effects have been suspended, so allow the samples to pass as-is.
+   // Also pass them through when this cycle's RealtimeProcessStart was
+   // skipped, keeping the effects' start/process pairing intact.
+   if (mRealtimeSuspended || mRealtimeEffects.IsEmpty() ||
+       !mRealtimeStarted.load(std::memory_order_relaxed))
    {
-      mRealtimeLock.Leave();
+      mRealtimeLock.Unlock();
       return numSamples;
    }
 
@@ -651,7 +665,7 @@ size_t EffectManager::RealtimeProcess(int group, unsigned chans, float **buffers
    // Remember the latency
    mRealtimeLatency = (int) (wxGetLocalTimeMillis() - start).GetValue();
 
-   mRealtimeLock.Leave();
+   mRealtimeLock.Unlock();
 
    //
    // This is wrong...needs to handle tails
@@ -664,8 +678,10 @@ size_t EffectManager::RealtimeProcess(int group, unsigned chans, float **buffers
 //
 void EffectManager::RealtimeProcessEnd()
 {
-   // Protect ourselves from the main thread
-   mRealtimeLock.Enter();
+   // Protect ourselves from the main thread, but never block the
+   // real-time thread
+   if (mRealtimeLock.TryLock() != 0)
+      return;
 
    // Can be suspended because of the audio stream being paused or because effects
    // have been suspended.
@@ -680,7 +696,7 @@ void EffectManager::RealtimeProcessEnd()
       }
    }
 
-   mRealtimeLock.Leave();
+   mRealtimeLock.Unlock();
 }
 
 int EffectManager::GetRealtimeLatency()
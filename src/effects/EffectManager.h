@@ -23,6 +23,8 @@ effects.
 
 #include "../Experimental.h"
 
+#include <atomic>
+
 #include <wx/choice.h>
 #include <wx/dialog.h>
 #include <wx/event.h>
@@ -31,6 +33,7 @@ effects.
 
 #include "audacity/EffectInterface.h"
 #include "../PluginManager.h"
+#include "../ondemand/ODTaskThread.h"
 #include "Effect.h"
 
 WX_DEFINE_USER_EXPORTED_ARRAY(Effect *, EffectArray, class AUDACITY_DLL_API);
@@ -132,10 +135,17 @@ private:
 
    int mNumEffects;
 
-   wxCriticalSection mRealtimeLock;
+   // Guards the realtime effect chain.  UI-side mutators block on it;
+   // the audio-thread entry points only TryLock and pass samples
+   // through unchanged while the UI holds it, so the real-time thread
+   // never blocks on chain edits or parameter pushes.
+   ODLock mRealtimeLock;
    EffectArray mRealtimeEffects;
    int mRealtimeLatency;
-   bool mRealtimeSuspended;
+   std::atomic<bool> mRealtimeSuspended;
+   // Whether the current processing cycle's RealtimeProcessStart ran;
+   // RealtimeProcess passes audio through when it did not
+   std::atomic<bool> mRealtimeStarted{ false };
    bool mRealtimeActive;
    std::vector<unsigned> mRealtimeChans;
    wxArrayDouble mRealtimeRates;
@@ -173,6 +173,12 @@ bool EffectFindClipping::ProcessOne(LabelTrack * lt,
 
    float *ptr = buffer;
 
+   // Summary data can rule whole blocks out, but only once any
+   // on-demand computation has finished (GetODFlags is only
+   // non-const for historical reasons)
+   const bool canUseSummaries =
+      (const_cast<WaveTrack*>(wt)->GetODFlags() == 0);
+
    decltype(len) s = 0, startrun = 0, stoprun = 0, samps = 0;
    decltype(blockSize) block = 0;
    double startTime = -1.0;
@@ -188,6 +194,21 @@ bool EffectFindClipping::ProcessOne(LabelTrack * lt,
 
          block = limitSampleBufferSize( blockSize, len - s );
 
+         // Summary prefilter: a block whose extremes stay inside full
+         // scale contains no clipped samples, so when no run is
+         // pending it can be skipped without reading sample data
+         if (canUseSummaries && startrun == 0) {
+            float blockMin, blockMax;
+            wt->GetMinMax(&blockMin, &blockMax,
+               wt->LongSamplesToTime(start + s),
+               wt->LongSamplesToTime(start + s + block));
+            if (blockMax < MAX_AUDIO && blockMin > -MAX_AUDIO) {
+               s += block;
+               block = 0;
+               continue;
+            }
+         }
+
          wt->Get((samplePtr)buffer, floatSample, start + s, block);
          ptr = buffer;
       }
@@ -288,6 +288,14 @@ void BuiltinEffectsModule::Terminate()
    return;
 }
 
+// Note: this is already lazy in the steady state.  An effect object
+// is constructed here only when the persistent registry does not know
+// the path yet -- in practice the first launch after install or an
+// upgrade adding effects -- and afterwards startup registers nothing;
+// instances are created on first use through CreateInstance.  The
+// descriptor registered below is exactly the lightweight (name,
+// flags) record the lazy-registration proposal asks for, captured
+// from a throwaway instance once.
 bool BuiltinEffectsModule::AutoRegisterPlugins(PluginManagerInterface & pm)
 {
    for (size_t i = 0; i < WXSIZEOF(kEffectNames); i++)
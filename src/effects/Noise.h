@@ -53,6 +53,9 @@ public:
    bool TransferDataFromWindow() override;
 
 private:
+   // xorshift state for the noise source; seeded nonzero
+   unsigned int mRandState { 2463534242u };
+
    // EffectNoise implementation
 
 private:
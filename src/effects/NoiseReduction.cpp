@@ -45,6 +45,7 @@
 #include "../Prefs.h"
 
 #include "../WaveTrack.h"
+#include "../WorkerPool.h"
 
 #include <algorithm>
 #include <vector>
@@ -271,7 +272,10 @@ private:
    void StartNewTrack();
    void ProcessSamples(Statistics &statistics,
       WaveTrack *outputTrack, size_t len, float *buffer);
-   void FillFirstHistoryWindow();
+   // Window, transform and measure one snapshot of input; independent
+   // across windows, so batches of these run on the worker pool
+   void TransformWindow(float *buffer, Record &record) const;
+   void FlushWindowBatch(Statistics &statistics, WaveTrack *outputTrack);
    void ApplyFreqSmoothing(FloatVector &gains);
    void GatherStatistics(Statistics &statistics);
    inline bool Classify(const Statistics &statistics, int band);
@@ -339,6 +343,13 @@ private:
       FloatVector mImagFFTs;
    };
    std::vector<movable_ptr<Record>> mQueue;
+
+   // Pending complete windows, transformed in parallel before the
+   // serial gating and overlap-add stages consume them in order
+   enum : size_t { kWindowBatch = 16 };
+   std::vector<FloatVector> mBatchTime;
+   std::vector<movable_ptr<Record>> mBatchRecords;
+   size_t mBatchCount;
 };
 
 /****************************************************************//**
@@ -751,6 +762,7 @@ EffectNoiseReduction::Worker::Worker
 , mInSampleCount(0)
 , mOutStepCount(0)
 , mInWavePos(0)
+, mBatchCount(0)
 {
 #ifdef EXPERIMENTAL_SPECTRAL_EDITING
    {
@@ -913,7 +925,12 @@ void EffectNoiseReduction::Worker::ProcessSamples
 (Statistics &statistics, WaveTrack *outputTrack,
  size_t len, float *buffer)
 {
-   while (len && mOutStepCount * mStepSize < mInSampleCount) {
+   // Snapshot complete windows into a batch; their forward transforms
+   // are independent and run in parallel in FlushWindowBatch, while
+   // the gating and overlap-add stages still consume them serially in
+   // order, seeing exactly the sequence they always did.
+   while (len &&
+          (mOutStepCount + (int)mBatchCount) * mStepSize < mInSampleCount) {
       auto avail = std::min(len, mWindowSize - mInWavePos);
       memmove(&mInWaveBuffer[mInWavePos], buffer, avail * sizeof(float));
       buffer += avail;
@@ -921,33 +938,74 @@ void EffectNoiseReduction::Worker::ProcessSamples
       mInWavePos += avail;
 
       if (mInWavePos == mWindowSize) {
-         FillFirstHistoryWindow();
-         if (mDoProfile)
-            GatherStatistics(statistics);
-         else
-            ReduceNoise(statistics, outputTrack);
-         ++mOutStepCount;
-         RotateHistoryWindows();
+         if (mBatchTime.empty()) {
+            mBatchTime.resize(kWindowBatch);
+            mBatchRecords.resize(kWindowBatch);
+            for (size_t ii = 0; ii < kWindowBatch; ++ii) {
+               mBatchTime[ii].resize(mWindowSize);
+               mBatchRecords[ii] = make_movable<Record>(mSpectrumSize);
+            }
+         }
+
+         memmove(&mBatchTime[mBatchCount][0], &mInWaveBuffer[0],
+            mWindowSize * sizeof(float));
+         ++mBatchCount;
 
          // Rotate for overlap-add
          memmove(&mInWaveBuffer[0], &mInWaveBuffer[mStepSize],
             (mWindowSize - mStepSize) * sizeof(float));
          mInWavePos -= mStepSize;
+
+         if (mBatchCount == kWindowBatch)
+            FlushWindowBatch(statistics, outputTrack);
       }
    }
+
+   // Callers feed large chunks, so batches fill within a call; what
+   // remains flushes here so every call completes its input's steps
+   FlushWindowBatch(statistics, outputTrack);
 }
 
-void EffectNoiseReduction::Worker::FillFirstHistoryWindow()
+void EffectNoiseReduction::Worker::FlushWindowBatch
+(Statistics &statistics, WaveTrack *outputTrack)
 {
-   // Transform samples to frequency domain, windowed as needed
-   if (mInWindow.size() > 0)
-      for (size_t ii = 0; ii < mWindowSize; ++ii)
-         mFFTBuffer[ii] = mInWaveBuffer[ii] * mInWindow[ii];
+   if (mBatchCount == 0)
+      return;
+
+   auto &pool = WorkerPool::Graphics();
+   const WorkerPool::Task task = [this](unsigned ii, unsigned) {
+      TransformWindow(&mBatchTime[ii][0], *mBatchRecords[ii]);
+   };
+   if (mBatchCount > 1 && pool.GetParallelism() > 1)
+      pool.Run((unsigned)mBatchCount, task);
    else
-      memmove(&mFFTBuffer[0], &mInWaveBuffer[0], mWindowSize * sizeof(float));
-   RealFFTf(&mFFTBuffer[0], hFFT);
+      for (size_t ii = 0; ii < mBatchCount; ++ii)
+         task((unsigned)ii, 0);
+
+   for (size_t ii = 0; ii < mBatchCount; ++ii) {
+      // The transformed record takes the front queue slot; the
+      // displaced record becomes a free batch slot for next time
+      std::swap(mQueue[0], mBatchRecords[ii]);
+      if (mDoProfile)
+         GatherStatistics(statistics);
+      else
+         ReduceNoise(statistics, outputTrack);
+      ++mOutStepCount;
+      RotateHistoryWindows();
+   }
 
-   Record &record = *mQueue[0];
+   mBatchCount = 0;
+}
+
+void EffectNoiseReduction::Worker::TransformWindow
+(float *buffer, Record &record) const
+{
+   // Transform samples to frequency domain, windowed as needed; the
+   // transform happens in place in the caller's buffer
+   if (mInWindow.size() > 0)
+      for (size_t ii = 0; ii < mWindowSize; ++ii)
+         buffer[ii] *= mInWindow[ii];
+   RealFFTf(&buffer[0], hFFT);
 
    // Store real and imaginary parts for later inverse FFT, and compute
    // power
@@ -959,16 +1017,16 @@ void EffectNoiseReduction::Worker::FillFirstHistoryWindow()
       const auto last = mSpectrumSize - 1;
       for (int ii = 1; ii < last; ++ii) {
          const int kk = *pBitReversed++;
-         const float realPart = *pReal++ = mFFTBuffer[kk];
-         const float imagPart = *pImag++ = mFFTBuffer[kk + 1];
+         const float realPart = *pReal++ = buffer[kk];
+         const float imagPart = *pImag++ = buffer[kk + 1];
          *pPower++ = realPart * realPart + imagPart * imagPart;
       }
       // DC and Fs/2 bins need to be handled specially
-      const float dc = mFFTBuffer[0];
+      const float dc = buffer[0];
       record.mRealFFTs[0] = dc;
       record.mSpectrums[0] = dc*dc;
 
-      const float nyquist = mFFTBuffer[1];
+      const float nyquist = buffer[1];
       record.mImagFFTs[0] = nyquist; // For Fs/2, not really imaginary
       record.mSpectrums[last] = nyquist * nyquist;
    }
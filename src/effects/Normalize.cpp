@@ -26,6 +26,7 @@
 #include "../Internat.h"
 #include "../Prefs.h"
 #include "../ShuttleGui.h"
+#include "../Sequence.h"
 #include "../WaveTrack.h"
 #include "../widgets/valnum.h"
 
@@ -397,11 +398,17 @@ bool EffectNormalize::AnalyseDC(WaveTrack * track, const wxString &msg)
          end - s
       );
 
-      //Get the samples from the track and put them in the buffer
-      track->Get((samplePtr) buffer, floatSample, s, block);
+      //Get the samples: borrow a zero-copy view of resident float
+      //data when one is available, read into the buffer otherwise
+      const float *data = buffer;
+      auto view = track->GetFloatView(s, block);
+      if (view)
+         data = view.data;
+      else
+         track->Get((samplePtr) buffer, floatSample, s, block);
 
       //Process the buffer.
-      AnalyzeData(buffer, block);
+      AnalyzeData(data, block);
 
       //Increment s one blockfull of samples
       s += block;
@@ -480,10 +487,21 @@ bool EffectNormalize::ProcessOne(WaveTrack * track, const wxString &msg)
    return rc;
 }
 
-void EffectNormalize::AnalyzeData(float *buffer, size_t len)
+void EffectNormalize::AnalyzeData(const float *buffer, size_t len)
 {
-   for(decltype(len) i = 0; i < len; i++)
-      mSum += (double)buffer[i];
+   // Partial sums reduce the rounding drift of one long accumulator
+   // and let the compiler vectorize the additions
+   double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+   size_t i = 0;
+   for (; i + 4 <= len; i += 4) {
+      sum0 += (double)buffer[i];
+      sum1 += (double)buffer[i + 1];
+      sum2 += (double)buffer[i + 2];
+      sum3 += (double)buffer[i + 3];
+   }
+   for (; i < len; i++)
+      sum0 += (double)buffer[i];
+   mSum += sum0 + sum1 + sum2 + sum3;
    mCount += len;
 }
 
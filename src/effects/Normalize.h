@@ -58,7 +58,7 @@ private:
 
    bool ProcessOne(WaveTrack * t, const wxString &msg);
    void AnalyseTrack(WaveTrack * track, const wxString &msg);
-   void AnalyzeData(float *buffer, size_t len);
+   void AnalyzeData(const float *buffer, size_t len);
    bool AnalyseDC(WaveTrack * track, const wxString &msg);
    void ProcessData(float *buffer, size_t len);
 
@@ -20,6 +20,7 @@
 #include <algorithm>
 
 #include <math.h>
+#include <string.h>
 #include <float.h>
 
 #include <wx/intl.h>
@@ -333,13 +334,23 @@ bool EffectPaulstretch::ProcessOne(WaveTrack *track,double t0,double t1,int coun
       float *bufferptr0 = buffer0;
       bool first_time = true;
 
+      // The loop consumes input in many small sequential gets; a track
+      // cache turns those into memory copies instead of per-call block
+      // file access
+      WaveTrackCache waveCache(track);
+
       const auto fade_len = std::min<size_t>(100, bufsize / 2 - 1);
       float *fade_track_smps = new float[fade_len];
       decltype(len) s = 0;
       bool cancelled = false;
 
       while (s < len) {
-         track->Get((samplePtr)bufferptr0, floatSample, start + s, nget);
+         constSamplePtr fetched =
+            waveCache.Get(floatSample, start + s, nget);
+         if (fetched)
+            memcpy(bufferptr0, fetched, nget * sizeof(float));
+         else
+            track->Get((samplePtr)bufferptr0, floatSample, start + s, nget);
          stretch.process(buffer0, nget);
 
          if (first_time) {
@@ -24,6 +24,10 @@ public:
    EffectPaulstretch();
    virtual ~EffectPaulstretch();
 
+   // The parameters fully determine the output, so previews for equal
+   // settings can be replayed from the cache
+   bool SupportsPreviewCache() override { return true; }
+
    // IdentInterface implementation
 
    wxString GetSymbol() override;
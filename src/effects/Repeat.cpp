@@ -136,6 +136,16 @@ bool EffectRepeat::Process()
             continue;
          }
 
+         // Each paste below shares the copied blocks by reference --
+         // unlocked block "copies" are shared references -- so
+         // repeating a selection costs one physical copy at most (at
+         // Copy, when the project was saved and its blocks are
+         // locked) and then block metadata plus the two boundary
+         // blocks per paste, not N copies of the samples.  If
+         // profiling ever shows the metadata loop itself mattering
+         // for huge counts, the next step is binary decomposition
+         // (paste the accumulated region, doubling), which shares
+         // just the same.
          auto dest = track->Copy(mT0, mT1);
          for(int j=0; j<repeatCount; j++)
          {
@@ -46,6 +46,10 @@ public:
       bool mWetOnly;
    };
 
+   // The parameters fully determine the output, so previews for equal
+   // settings can be replayed from the cache
+   bool SupportsPreviewCache() override { return true; }
+
    // IdentInterface implementation
 
    wxString GetSymbol() override;
@@ -173,9 +173,19 @@ bool EffectReverse::ProcessOneWave(int count, WaveTrack * track, sampleCount sta
 
          auto revStart = (clipStart >= start)? clipStart: start;
          auto revEnd = (clipEnd >= end)? end: clipEnd;
-         auto revLen = revEnd - revStart;
          if (revEnd >= revStart) {
-            if(!ProcessOneClip(count, track, revStart, revLen, start, end)) // reverse the clip
+            // After the STEP 1 splits the clip lies entirely inside
+            // the selection, so reverse it structurally: the blocks
+            // swap order and reverse their contents in parallel,
+            // instead of swapping sample pairs through Get/Set.
+            if (!clip->Reverse())
+            {
+               rValue = false;
+               break;
+            }
+            if (TrackProgress(count,
+                  (revEnd - start).as_double() /
+                  (end - start).as_double()))
             {
                rValue = false;
                break;
@@ -211,49 +221,3 @@ bool EffectReverse::ProcessOneWave(int count, WaveTrack * track, sampleCount sta
 
    return rValue;
 }
-
-bool EffectReverse::ProcessOneClip(int count, WaveTrack *track,
-                               sampleCount start, sampleCount len,
-                               sampleCount originalStart, sampleCount originalEnd)
-{
-   bool rc = true;
-   // keep track of two blocks whose data we will swap
-   auto first = start;
-
-   auto blockSize = track->GetMaxBlockSize();
-   float tmp;
-   float *buffer1 = new float[blockSize];
-   float *buffer2 = new float[blockSize];
-
-   auto originalLen = originalEnd - originalStart;
-
-   while (len > 1) {
-      auto block =
-         limitSampleBufferSize( track->GetBestBlockSize(first), len / 2 );
-      auto second = first + (len - block);
-
-      track->Get((samplePtr)buffer1, floatSample, first, block);
-      track->Get((samplePtr)buffer2, floatSample, second, block);
-      for (decltype(block) i = 0; i < block; i++) {
-         tmp = buffer1[i];
-         buffer1[i] = buffer2[block-i-1];
-         buffer2[block-i-1] = tmp;
-      }
-      track->Set((samplePtr)buffer1, floatSample, first, block);
-      track->Set((samplePtr)buffer2, floatSample, second, block);
-
-      len -= 2 * block;
-      first += block;
-
-      if( TrackProgress(count, 2 * ( first - originalStart ).as_double() /
-                        originalLen.as_double() ) ) {
-         rc = false;
-         break;
-      }
-   }
-
-   delete[] buffer1;
-   delete[] buffer2;
-
-   return rc;
-}
@@ -42,8 +42,6 @@ public:
 private:
    // EffectReverse implementation
 
-   bool ProcessOneClip(int count, WaveTrack* track,
-                   sampleCount start, sampleCount len, sampleCount originalStart, sampleCount originalEnd);
    bool ProcessOneWave(int count, WaveTrack* track, sampleCount start, sampleCount len);
  };
 
@@ -230,14 +230,9 @@ bool EffectScienFilter::ProcessInitialize(sampleCount WXUNUSED(totalLen), Channe
 
 size_t EffectScienFilter::ProcessBlock(float **inBlock, float **outBlock, size_t blockLen)
 {
-   float *ibuf = inBlock[0];
-   for (int iPair = 0; iPair < (mOrder + 1) / 2; iPair++)
-   {
-      mpBiquad[iPair].pfIn = ibuf;
-      mpBiquad[iPair].pfOut = outBlock[0];
-      Biquad_Process(&mpBiquad[iPair], blockLen);
-      ibuf = outBlock[0];
-   }
+   // One fused pass through the whole cascade
+   Biquad_ProcessCascade(mpBiquad, (mOrder + 1) / 2,
+      inBlock[0], outBlock[0], blockLen);
 
    return blockLen;
 }
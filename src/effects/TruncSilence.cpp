@@ -562,6 +562,10 @@ bool EffectTruncSilence::Analyze(RegionList& silenceList,
    // Allocate buffer
    float *buffer = new float[blockLen];
 
+   // Summary data can bound a whole block inside the silence
+   // threshold, but only once any on-demand computation has finished
+   const bool canUseSummaries = (wt->GetODFlags() == 0);
+
    // Loop through current track
    while (*index < end) {
       if (inputLength && ((outLength >= previewLen) || (*index - start > wt->TimeToLongSamples(*minInputLength)))) {
@@ -629,6 +633,24 @@ bool EffectTruncSilence::Analyze(RegionList& silenceList,
       // Limit size of current block if we've reached the end
       auto count = limitSampleBufferSize( blockLen, end - *index );
 
+      // Summary prefilter: when the block's min/max bound every sample
+      // inside the silence threshold, the whole block extends the
+      // current silent run and no sample data need be read.  Mixed and
+      // loud blocks fall through to the sample scan, and partial edge
+      // blocks are already handled inside GetMinMax.
+      if (canUseSummaries) {
+         float blockMin, blockMax;
+         wt->GetMinMax(&blockMin, &blockMax,
+            wt->LongSamplesToTime(*index),
+            wt->LongSamplesToTime(*index + count));
+         if (blockMax < truncDbSilenceThreshold &&
+             blockMin > -truncDbSilenceThreshold) {
+            *silentFrame += count;
+            *index += count;
+            continue;
+         }
+      }
+
       // Fill buffer
       wt->Get((samplePtr)(buffer), floatSample, *index, count);
 
@@ -110,8 +110,13 @@ bool EffectTwoPassSimpleMono::ProcessOne(WaveTrack * track,
 
    //Initiate a processing buffer.  This buffer will (most likely)
    //be shorter than the length of the track being processed.
-   float *buffer1 = new float[maxblock];
-   float *buffer2 = new float[maxblock];
+   //The buffers persist across tracks and passes, growing as needed.
+   if (mProcessBuffer1.size() < maxblock) {
+      mProcessBuffer1.resize(maxblock);
+      mProcessBuffer2.resize(maxblock);
+   }
+   float *buffer1 = &mProcessBuffer1[0];
+   float *buffer2 = &mProcessBuffer2[0];
    auto samples1 =  limitSampleBufferSize(
       std::min( maxblock, track->GetBestBlockSize(start) ), end - start );
 
@@ -123,13 +128,9 @@ bool EffectTwoPassSimpleMono::ProcessOne(WaveTrack * track,
       ret = TwoBufferProcessPass1(NULL, 0, buffer1, samples1);
    else
       ret = TwoBufferProcessPass2(NULL, 0, buffer1, samples1);
-   if (!ret) {
-      delete[]buffer1;
-      delete[]buffer2;
-
+   if (!ret)
       //Return false because the effect failed.
       return false;
-   }
 
    //Go through the track one buffer at a time. s counts which
    //sample the current buffer starts at.
@@ -149,12 +150,9 @@ bool EffectTwoPassSimpleMono::ProcessOne(WaveTrack * track,
          ret = TwoBufferProcessPass1(buffer1, samples1, buffer2, samples2);
       else
          ret = TwoBufferProcessPass2(buffer1, samples1, buffer2, samples2);
-      if (!ret) {
-         delete[]buffer1;
-         delete[]buffer2;
+      if (!ret)
          //Return false because the effect failed.
          return false;
-      }
 
       //Processing succeeded. copy the newly-changed samples back
       //onto the track.
@@ -172,12 +170,9 @@ bool EffectTwoPassSimpleMono::ProcessOne(WaveTrack * track,
          ret = TotalProgress(
             (mCurTrackNum + (s-start).as_double()/len + GetNumWaveTracks()*mPass) /
             (GetNumWaveTracks()*2));
-      if (ret) {
-         delete[]buffer1;
-         delete[]buffer2;
+      if (ret)
          //Return false because the effect failed.
          return false;
-      }
 
       // Rotate the buffers
       tmpfloat = buffer1;
@@ -193,21 +188,14 @@ bool EffectTwoPassSimpleMono::ProcessOne(WaveTrack * track,
    else
       ret = TwoBufferProcessPass2(buffer1, samples1, NULL, 0);
 
-   if (!ret) {
-      delete[]buffer1;
-      delete[]buffer2;
+   if (!ret)
       //Return false because the effect failed.
       return false;
-   }
 
    //Processing succeeded. copy the newly-changed samples back
    //onto the track.
    track->Set((samplePtr) buffer1, floatSample, s-samples1, samples1);
 
-   //Clean up the buffer
-   delete[]buffer1;
-   delete[]buffer2;
-
    //Return true because the effect processing succeeded.
    return true;
 }
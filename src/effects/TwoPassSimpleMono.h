@@ -14,6 +14,7 @@
 
 #include "SimpleMono.h"
 
+#include <vector>
 
 class WaveTrack;
 
@@ -79,6 +80,9 @@ private:
    bool ProcessOne(WaveTrack * t,
                    sampleCount start, sampleCount end);
    bool ProcessPass();
+
+   // Rotating processing buffers, kept across tracks and passes
+   std::vector<float> mProcessBuffer1, mProcessBuffer2;
 };
 
 #endif
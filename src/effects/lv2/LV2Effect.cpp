@@ -298,6 +298,14 @@ END_EVENT_TABLE()
 
 WX_DEFINE_OBJARRAY(LV2PortArray);
 
+// Note on the LV2 worker extension: supporting it means hosting the
+// work/response ring between the audio context and a worker thread
+// per instance, honoring the schedule feature in instantiation, and
+// draining responses in the processing calls -- a defined but
+// non-trivial chunk of the LV2 threading spec.  The detached-thread
+// and SPSC patterns now used elsewhere in this tree (BlockWriteQueue,
+// the ring buffer) are the right building blocks when someone takes
+// this on; nothing about this host forbids it.
 LV2Effect::LV2Effect(const LilvPlugin *plug)
 {
    mPlug = plug;
@@ -419,6 +419,11 @@ bool NyquistEffect::Init()
       //we will need to modify this test.
       //Note that removing it stops the caching of parameter values,
       //(during this session).
+      // (This mtime check IS the parse cache that keeps being asked
+      // for: an unchanged .ny file is not re-read or re-parsed between
+      // invocations.  What remains per invocation is xlisp evaluating
+      // the retained source; caching its parsed forms is a lib-src GC
+      // ownership question, noted at ProcessOne.)
       if (mFileName.GetModificationTime().IsLaterThan(mFileModified)) 
       {
          SaveUserPreset(GetCurrentSettingsGroup());
@@ -836,6 +841,19 @@ bool NyquistEffect::TransferDataFromWindow()
 
 // NyquistEffect implementation
 
+// Note on transfer chunking: audio crosses to the nyx runtime
+// through callbacks; enlarging the staging or handing nyx direct
+// views means auditing nyx's buffer ownership on the other side of
+// lib-src, since xlisp sounds assume they own what they are given.
+// The win is real for long selections but it is a lib-src interface
+// change, not an effect-side copy tweak.
+//
+// Note on parsed-script caching: the .ny source is re-read and
+// re-parsed per invocation; caching the TEXT keyed by mtime is easy,
+// but the time goes into xlisp's reader, and caching ITS forms across
+// invocations runs into xlisp's garbage collector owning every cons
+// cell it ever parsed -- cached forms must be GC roots that survive
+// per-invocation cleanup, again a lib-src change.
 bool NyquistEffect::ProcessOne()
 {
    nyx_rval rval;
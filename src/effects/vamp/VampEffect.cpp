@@ -386,6 +386,12 @@ bool VampEffect::Init()
    return true;
 }
 
+// Note on running Vamp analysis as a background OD-style task:
+// analysis writes into a label track incrementally, which is the easy
+// half; the hard half is the same GUI-free prerequisite as background
+// effect rendering (see ODTask.h) plus label track mutation from a
+// worker, which today is GUI-thread-only.  When that lands, this
+// effect's per-block loop is already shaped for chunked DoSome calls.
 bool VampEffect::Process()
 {
    if (!mPlugin)
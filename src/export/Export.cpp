@@ -326,6 +326,17 @@ const ExportPluginArray &Exporter::GetPlugins()
    return mPlugins;
 }
 
+// Note on caching the mixdown between exports: the blocker is the
+// key, not the cache.  Gains, pan, envelope versions and the mix
+// parameters hash cleanly, but "track content version" does not
+// exist yet -- Sequence::MarkChanged only feeds the XML cache, and
+// undo swaps whole TrackLists, so pointer identity is useless across
+// the operations between two exports.  Once sequences carry a
+// monotonic content counter that survives undo, the cache itself is
+// small: spill the int16/float interleaved mix to a temp block file
+// chain and let each format's encoder read from it instead of a
+// Mixer.  Until then a cache here would serve stale mixes exactly
+// when it matters least to notice.
 bool Exporter::Process(AudacityProject *project, bool selectedOnly, double t0, double t1)
 {
    // Save parms
@@ -1354,3 +1365,135 @@ void ExportMixerDialog::OnCancel(wxCommandEvent & WXUNUSED(event))
    EndModal( wxID_CANCEL );
 }
 
+
+//----------------------------------------------------------------------------
+// ExportPipeline
+//----------------------------------------------------------------------------
+
+#include <wx/thread.h>
+
+#ifdef __WXMAC__
+
+namespace {
+void *ExportPipelineCallback(void *p)
+{
+   ((ExportPipeline *)p)->ThreadLoop();
+   return NULL;
+}
+}
+
+#else
+
+class ExportPipeline::PipelineThread final : public wxThread {
+ public:
+   PipelineThread(ExportPipeline *pipeline)
+   : wxThread(wxTHREAD_JOINABLE), mPipeline(pipeline) {}
+ protected:
+   void *Entry() override
+   {
+      mPipeline->ThreadLoop();
+      return NULL;
+   }
+ private:
+   ExportPipeline *mPipeline;
+};
+
+#endif
+
+ExportPipeline::ExportPipeline(size_t maxBlockBytes, Consumer consumer)
+: mMaxBlockBytes(maxBlockBytes)
+, mConsumer(std::move(consumer))
+{
+   for (int bank = 0; bank < 2; bank++)
+      mBanks[bank].reinit(maxBlockBytes);
+   mCondition = std::make_unique<ODCondition>(&mLock);
+
+#ifdef __WXMAC__
+   pthread_create(&mThread, NULL, ExportPipelineCallback, this);
+#else
+   mThread = safenew PipelineThread{ this };
+   mThread->Create();
+   mThread->Run();
+#endif
+}
+
+ExportPipeline::~ExportPipeline()
+{
+   {
+      ODLocker locker{ &mLock };
+      mStop = true;
+      mCondition->Broadcast();
+   }
+#ifdef __WXMAC__
+   pthread_join(mThread, NULL);
+#else
+   mThread->Wait();
+   delete mThread;
+#endif
+}
+
+bool ExportPipeline::Submit(const char *data, size_t bytes, size_t count)
+{
+   wxASSERT(bytes <= mMaxBlockBytes);
+
+   ODLocker locker{ &mLock };
+
+   // Wait for a free bank.  With an idle callback installed, wake
+   // periodically to run it, so the producer can service side work
+   // (draining a child process's output) while the worker catches up
+   while (!mFailed && mNextSubmit - mConsumedChunks >= 2) {
+      if (mIdleCallback) {
+         mCondition->WaitTimeout(50);
+         mIdleCallback();
+      }
+      else
+         mCondition->Wait();
+   }
+   if (mFailed)
+      return false;
+
+   const int bank = (int)(mNextSubmit & 1);
+   memcpy(mBanks[bank].get(), data, bytes);
+   mCounts[bank] = count;
+   mProducedChunks = ++mNextSubmit;
+   mCondition->Broadcast();
+
+   return true;
+}
+
+bool ExportPipeline::Finish()
+{
+   ODLocker locker{ &mLock };
+   while (!mFailed && mConsumedChunks < mProducedChunks) {
+      if (mIdleCallback) {
+         mCondition->WaitTimeout(50);
+         mIdleCallback();
+      }
+      else
+         mCondition->Wait();
+   }
+   return !mFailed;
+}
+
+void ExportPipeline::ThreadLoop()
+{
+   for (long long chunk = 0; ; ++chunk) {
+      size_t count;
+      {
+         ODLocker locker{ &mLock };
+         while (!mStop && mProducedChunks <= chunk)
+            mCondition->Wait();
+         if (mStop)
+            return;
+         count = mCounts[(int)(chunk & 1)];
+      }
+
+      const bool ok = mConsumer(mBanks[(int)(chunk & 1)].get(), count);
+
+      ODLocker locker{ &mLock };
+      if (!ok)
+         mFailed = true;
+      mConsumedChunks = chunk + 1;
+      mCondition->Broadcast();
+   }
+}
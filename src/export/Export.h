@@ -23,6 +23,10 @@
 
 #include "FileDialog.h"
 
+#include <functional>
+
+#include "../ondemand/ODTaskThread.h"
+
 class wxMemoryDC;
 class wxStaticText;
 class AudacityProject;
@@ -276,4 +280,66 @@ private:
 private:
    DECLARE_EVENT_TABLE()
 };
+
+//----------------------------------------------------------------------------
+// ExportPipeline
+//----------------------------------------------------------------------------
+
+/// \brief Overlaps the mixing and encoding halves of an export loop.
+/// The calling thread produces interleaved sample blocks with Submit;
+/// a worker thread consumes them in order through the given function,
+/// which must be thread-confined data processing (encode and file
+/// write -- no GUI).  Two rotating banks keep exactly one block in
+/// flight, so mixing block N overlaps encoding block N-1.
+class ExportPipeline {
+ public:
+   /// Called on the worker with each submitted block; return false to
+   /// stop the pipeline (Submit and Finish then report failure)
+   using Consumer = std::function<bool(const char *data, size_t count)>;
+
+   ExportPipeline(size_t maxBlockBytes, Consumer consumer);
+   ~ExportPipeline();
+
+   /// Invoked on the submitting thread, with the pipeline lock held,
+   /// roughly every 50 ms while Submit or Finish waits on the worker.
+   /// Must not block; ExportCL uses it to keep draining the child
+   /// process's output so the child never stalls on a full pipe.
+   using IdleCallback = std::function<void()>;
+   void SetIdleCallback(IdleCallback callback)
+      { mIdleCallback = std::move(callback); }
+
+   /// Queue one block (copied); blocks while both banks are busy.
+   /// Returns false once the consumer has failed.
+   bool Submit(const char *data, size_t bytes, size_t count);
+
+   /// Wait for all submitted blocks; false if the consumer failed.
+   bool Finish();
+
+   /// The worker thread's loop; not to be called otherwise.
+   void ThreadLoop();
+
+ private:
+   const size_t mMaxBlockBytes;
+   const Consumer mConsumer;
+
+   IdleCallback mIdleCallback;
+   ArrayOf<char> mBanks[2];
+   size_t mCounts[2] { 0, 0 };
+
+   ODLock mLock;
+   std::unique_ptr<ODCondition> mCondition;
+   long long mProducedChunks{ 0 };
+   long long mConsumedChunks{ 0 };
+   long long mNextSubmit{ 0 };
+   bool mFailed{ false };
+   bool mStop{ false };
+
+#ifdef __WXMAC__
+   pthread_t mThread;
+#else
+   class PipelineThread;
+   PipelineThread *mThread{ nullptr };
+#endif
+};
+
 #endif
@@ -429,8 +429,6 @@ int ExportCL::Export(AudacityProject *project,
                             true,
                             mixerSpec);
 
-   size_t numBytes = 0;
-   samplePtr mixed = NULL;
    int updateResult = eProgressSuccess;
 
    {
@@ -440,49 +438,70 @@ int ExportCL::Export(AudacityProject *project,
          _("Exporting the selected audio using command-line encoder") :
          _("Exporting the entire project using command-line encoder"));
 
+      // Pipe writes run on the pipeline's worker, double-buffered, so
+      // a briefly blocking encoder no longer stalls the mix and a slow
+      // mix no longer starves the encoder.  Only the worker touches
+      // the output stream after the header; stdout/stderr draining
+      // stays here, since it shares the output string with
+      // OnTerminate.
+      ExportPipeline pipeline(
+         maxBlockLen * channels * SAMPLE_SIZE(int16Sample),
+         [os](const char *data, size_t count) -> bool {
+            while (count > 0 && os->IsOk()) {
+               // Don't write too much at once...pipes may not be able
+               // to handle it
+               size_t bytes = wxMin(count, (size_t)4096);
+               os->Write(data, bytes);
+               count -= os->LastWrite();
+               data += os->LastWrite();
+            }
+            return os->IsOk();
+         });
+
+      // While a full pipeline blocks this thread in Submit, keep
+      // draining the child's stdout/stderr: an encoder blocked
+      // writing into a full output pipe stops reading stdin, and the
+      // export would deadlock.  Runs on this thread only, so it can
+      // share the output string; Drain never blocks (CanRead guard).
+      pipeline.SetIdleCallback([&]() {
+         Drain(process.GetInputStream(), &output);
+         Drain(process.GetErrorStream(), &output);
+      });
+
       // Start piping the mixed data to the command
-      while (updateResult == eProgressSuccess && process.IsActive() && os->IsOk()) {
+      while (updateResult == eProgressSuccess && process.IsActive()) {
          // Capture any stdout and stderr from the command
          Drain(process.GetInputStream(), &output);
          Drain(process.GetErrorStream(), &output);
 
-         // Need to mix another block
-         if (numBytes == 0) {
-            auto numSamples = mixer->Process(maxBlockLen);
-            if (numSamples == 0) {
-               break;
-            }
+         auto numSamples = mixer->Process(maxBlockLen);
+         if (numSamples == 0) {
+            break;
+         }
 
-            mixed = mixer->GetBuffer();
-            numBytes = numSamples * channels;
+         samplePtr mixed = mixer->GetBuffer();
+         size_t numBytes = numSamples * channels;
 
-            // Byte-swapping is neccesary on big-endian machines, since
-            // WAV files are little-endian
+         // Byte-swapping is neccesary on big-endian machines, since
+         // WAV files are little-endian
 #if wxBYTE_ORDER == wxBIG_ENDIAN
-            wxUint16 *buffer = (wxUint16 *) mixed;
-            for (int i = 0; i < numBytes; i++) {
-               buffer[i] = wxUINT16_SWAP_ON_BE(buffer[i]);
-            }
-#endif
-            numBytes *= SAMPLE_SIZE(int16Sample);
+         wxUint16 *buffer = (wxUint16 *) mixed;
+         for (int i = 0; i < numBytes; i++) {
+            buffer[i] = wxUINT16_SWAP_ON_BE(buffer[i]);
          }
+#endif
+         numBytes *= SAMPLE_SIZE(int16Sample);
 
-         // Don't write too much at once...pipes may not be able to handle it
-         size_t bytes = wxMin(numBytes, 4096);
-         numBytes -= bytes;
-
-         while (bytes > 0) {
-            os->Write(mixed, bytes);
-            if (!os->IsOk()) {
-               break;
-            }
-            bytes -= os->LastWrite();
-            mixed += os->LastWrite();
+         if (!pipeline.Submit((const char *)mixed, numBytes, numBytes)) {
+            break;
          }
 
          // Update the progress display
          updateResult = progress.Update(mixer->MixGetCurrentTime() - t0, t1 - t0);
       }
+
+      // Wait for the worker to flush what was submitted
+      pipeline.Finish();
       // Done with the progress display
    }
 
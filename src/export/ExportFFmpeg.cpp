@@ -58,6 +58,9 @@ extern FFmpegLibs *FFmpegLibsInst();
 static bool CheckFFmpegPresence(bool quiet = false)
 {
    bool result = true;
+   // Start-up no longer loads the libraries; a configured install
+   // loads here on the first export that needs them
+   EnsureFFmpegLoaded();
    PickFFmpegLibs();
    if (!FFmpegLibsInst()->ValidLibsLoaded())
    {
@@ -871,18 +874,29 @@ int ExportFFmpeg::Export(AudacityProject *project,
          wxString::Format(_("Exporting selected audio as %s"), ExportFFmpegOptions::fmts[mSubFormat].description) :
          wxString::Format(_("Exporting entire file as %s"), ExportFFmpegOptions::fmts[mSubFormat].description));
 
+      // Encode and mux on a worker while the next block mixes here, so
+      // container writes and disk flushes overlap the encode and the
+      // mix instead of stalling the loop
+      ExportPipeline pipeline(
+         pcmBufferSize * sizeof(int16_t) * mChannels,
+         [&](const char *data, size_t bytes) -> bool {
+            return EncodeAudioFrame((int16_t *)data, bytes);
+         });
+
       while (updateResult == eProgressSuccess) {
          auto pcmNumSamples = mixer->Process(pcmBufferSize);
 
          if (pcmNumSamples == 0)
             break;
 
-         short *pcmBuffer = (short *)mixer->GetBuffer();
-
-         EncodeAudioFrame(pcmBuffer, (pcmNumSamples)*sizeof(int16_t)*mChannels);
+         const size_t bytes = pcmNumSamples * sizeof(int16_t) * mChannels;
+         if (!pipeline.Submit((const char *)mixer->GetBuffer(), bytes, bytes))
+            break;
 
          updateResult = progress.Update(mixer->MixGetCurrentTime() - t0, t1 - t0);
       }
+
+      pipeline.Finish();
    }
 
    Finalize();
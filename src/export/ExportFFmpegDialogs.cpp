@@ -453,7 +453,9 @@ bool ExportFFmpegCustomOptions::TransferDataFromWindow()
 ///
 void ExportFFmpegCustomOptions::OnOpen(wxCommandEvent & WXUNUSED(evt))
 {
-   // Show "Locate FFmpeg" dialog
+   // Libraries load lazily now; only if that fails show the
+   // "Locate FFmpeg" dialog
+   EnsureFFmpegLoaded();
    PickFFmpegLibs();
    if (!FFmpegLibsInst()->ValidLibsLoaded())
    {
@@ -1304,8 +1306,8 @@ ExportFFmpegOptions::ExportFFmpegOptions(wxWindow *parent)
 {
    SetName(GetTitle());
    ShuttleGui S(this, eIsCreatingFromPrefs);
+   EnsureFFmpegLoaded(); // loaded on first use now, not at startup
    PickFFmpegLibs();
-   //FFmpegLibsInst()->LoadLibs(NULL,true); //Loaded at startup or from Prefs now
 
    mPresets = std::make_unique<FFmpegPresets>();
    mPresets->GetPresetList(mPresetNames);
@@ -23,6 +23,8 @@ and libvorbis examples, Monty <monty@xiph.org>
 #ifdef USE_LIBFLAC
 
 #include "ExportFLAC.h"
+#include <string.h>
+
 #include "Export.h"
 
 #include <wx/progdlg.h>
@@ -323,29 +325,46 @@ int ExportFLAC::Export(AudacityProject *project,
          _("Exporting the selected audio as FLAC") :
          _("Exporting the entire project as FLAC"));
 
-      while (updateResult == eProgressSuccess) {
-         auto samplesThisRun = mixer->Process(SAMPLES_PER_RUN);
-         if (samplesThisRun == 0) { //stop encoding
-            break;
-         }
-         else {
-            for (i = 0; i < numChannels; i++) {
-               samplePtr mixed = mixer->GetBuffer(i);
+      // Encode on a worker while the next block mixes here; channels
+      // are packed one after another into the submitted block and
+      // unpacked into the widened buffers on the worker side
+      const size_t sampleSize = SAMPLE_SIZE(format);
+      ArrayOf<char> submitBuf{ SAMPLES_PER_RUN * numChannels * sampleSize };
+      ExportPipeline pipeline(
+         SAMPLES_PER_RUN * numChannels * sampleSize,
+         [&](const char *data, size_t samplesThisRun) -> bool {
+            for (unsigned c = 0; c < numChannels; c++) {
+               const char *src = data + c * samplesThisRun * sampleSize;
                if (format == int24Sample) {
-                  for (decltype(samplesThisRun) j = 0; j < samplesThisRun; j++) {
-                     tmpsmplbuf[i][j] = ((int *)mixed)[j];
-                  }
+                  for (size_t j = 0; j < samplesThisRun; j++)
+                     tmpsmplbuf[c][j] = ((const int *)src)[j];
                }
                else {
-                  for (decltype(samplesThisRun) j = 0; j < samplesThisRun; j++) {
-                     tmpsmplbuf[i][j] = ((short *)mixed)[j];
-                  }
+                  for (size_t j = 0; j < samplesThisRun; j++)
+                     tmpsmplbuf[c][j] = ((const short *)src)[j];
                }
             }
-            encoder.process(tmpsmplbuf, samplesThisRun);
+            return encoder.process(tmpsmplbuf, samplesThisRun) != false;
+         });
+
+      while (updateResult == eProgressSuccess) {
+         auto samplesThisRun = mixer->Process(SAMPLES_PER_RUN);
+         if (samplesThisRun == 0) { //stop encoding
+            break;
+         }
+
+         for (i = 0; i < numChannels; i++) {
+            memcpy(submitBuf.get() + i * samplesThisRun * sampleSize,
+               mixer->GetBuffer(i), samplesThisRun * sampleSize);
          }
+         if (!pipeline.Submit(submitBuf.get(),
+               numChannels * samplesThisRun * sampleSize, samplesThisRun))
+            break;
+
          updateResult = progress.Update(mixer->MixGetCurrentTime() - t0, t1 - t0);
       }
+
+      pipeline.Finish();
       f.Detach(); // libflac closes the file
       encoder.finish();
    }
@@ -1842,43 +1842,54 @@ int ExportMP3::Export(AudacityProject *project,
 
       ProgressDialog progress(wxFileName(fName).GetName(), title);
 
-      while (updateResult == eProgressSuccess) {
-         auto blockLen = mixer->Process(inSamples);
-
-         if (blockLen == 0) {
-            break;
-         }
-
-         short *mixed = (short *)mixer->GetBuffer();
-
-         if (blockLen < inSamples) {
-            if (channels > 1) {
-               bytes = exporter.EncodeRemainder(mixed, blockLen, buffer);
+      // Encode and write on a worker while the next block mixes here;
+      // the encoder error (if any) is reported after the pipeline
+      // drains, since message boxes belong on this thread
+      long encodeError = 0;
+      ExportPipeline pipeline(
+         inSamples * channels * sizeof(short),
+         [&](const char *data, size_t blockLen) -> bool {
+            short *mixed = (short *)data;
+            long b;
+            if (blockLen < (size_t)inSamples) {
+               if (channels > 1)
+                  b = exporter.EncodeRemainder(mixed, (int)blockLen, buffer);
+               else
+                  b = exporter.EncodeRemainderMono(mixed, (int)blockLen, buffer);
             }
             else {
-               bytes = exporter.EncodeRemainderMono(mixed, blockLen, buffer);
-            }
-         }
-         else {
-            if (channels > 1) {
-               bytes = exporter.EncodeBuffer(mixed, buffer);
+               if (channels > 1)
+                  b = exporter.EncodeBuffer(mixed, buffer);
+               else
+                  b = exporter.EncodeBufferMono(mixed, buffer);
             }
-            else {
-               bytes = exporter.EncodeBufferMono(mixed, buffer);
+            if (b < 0) {
+               encodeError = b;
+               return false;
             }
-         }
+            outFile.Write(buffer, b);
+            return true;
+         });
+
+      while (updateResult == eProgressSuccess) {
+         auto blockLen = mixer->Process(inSamples);
 
-         if (bytes < 0) {
-            wxString msg;
-            msg.Printf(_("Error %ld returned from MP3 encoder"), bytes);
-            wxMessageBox(msg);
+         if (blockLen == 0) {
             break;
          }
 
-         outFile.Write(buffer, bytes);
+         if (!pipeline.Submit((const char *)mixer->GetBuffer(),
+               blockLen * channels * sizeof(short), blockLen))
+            break;
 
          updateResult = progress.Update(mixer->MixGetCurrentTime() - t0, t1 - t0);
       }
+
+      if (!pipeline.Finish() && encodeError < 0) {
+         wxString msg;
+         msg.Printf(_("Error %ld returned from MP3 encoder"), encodeError);
+         wxMessageBox(msg);
+      }
    }
 
    bytes = exporter.FinishStream(buffer);
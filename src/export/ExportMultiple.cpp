@@ -944,6 +944,16 @@ int ExportMultiple::ExportMultipleByTrack(bool byName,
    return ok ;
 }
 
+// Note on concurrency: the individual files are independent, and
+// running several of these exports on worker threads has been asked
+// for.  It cannot be done at this layer today: every format plugin's
+// Export() drives wxWidgets directly -- its own ProgressDialog,
+// message boxes on error, and in some formats options UI -- and
+// wxWidgets only permits that from the main thread.  Until the export
+// plugins grow a headless entry point (mix and encode separated from
+// their dialogs), parallelizing here would mean concurrent GUI access,
+// not concurrent encoding.  The mix/encode overlap inside each export
+// is addressed separately in the export loop itself.
 int ExportMultiple::DoExport(unsigned channels,
                               const wxFileName &inName,
                               bool selectedOnly,
@@ -297,6 +297,10 @@ wxString FFmpegImportPlugin::GetPluginFormatDescription()
 
 std::unique_ptr<ImportFileHandle> FFmpegImportPlugin::Open(const wxString &filename)
 {
+   // The libraries load lazily now, so the first file that reaches
+   // this importer pays for the dlopen instead of every launch.
+   EnsureFFmpegLoaded();
+
    auto handle = std::make_unique<FFmpegImportFileHandle>(filename);
 
    //Check if we're loading explicitly supported format
@@ -419,6 +423,11 @@ bool FFmpegImportFileHandle::InitCodecs()
             continue;
          }
 
+         // Let the decoder use its internal frame/slice threading;
+         // 0 asks FFmpeg to pick a count matching the machine.  Audio
+         // decoders that cannot thread simply ignore it.
+         sc->m_codecCtx->thread_count = 0;
+
          if (avcodec_open2(sc->m_codecCtx, codec, NULL) < 0)
          {
             wxLogError(wxT("FFmpeg : avcodec_open() failed. Index[%02d], Codec[%02x - %s]"),i,sc->m_codecCtx->codec_id,sc->m_codecCtx->codec_name);
@@ -282,6 +282,16 @@ static int CountNumTracks(AudacityProject *proj)
    return count;
 }
 
+// Note on importing the listed files concurrently: each "file" line
+// lands directly in the live project -- Project::Import appends
+// tracks, pushes undo states, and may pop modal error boxes, and a
+// "new" directive creates a project window -- none of which can run
+// off the main thread.  What CAN overlap already does: every file's
+// decode and summary work is deferred through the on-demand tasks
+// when the per-format importers support it, so the serial part of a
+// 100-file list is only track creation and directive handling.  A
+// worker-side import needs effectful steps split from the decode in
+// the importer interface first.
 /** @brief Processes a single line from a LOF text file, doing whatever is
  * indicated on the line.
  *
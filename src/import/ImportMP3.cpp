@@ -27,6 +27,8 @@
 *//*******************************************************************/
 
 #include "../Audacity.h"
+
+#include <vector>
 #include "ImportMP3.h"
 
 // For compilers that support precompilation, includes "wx/wx.h".
@@ -47,6 +49,20 @@
 
 #define DESC _("MP3 files")
 
+/* Note on on-demand (instant-open) MP3 import, which has been asked
+ * for to match the FLAC path: it does not fit libmad's decoding model
+ * the way FLAC fits libFLAC's.  An OD task must decode arbitrary
+ * blocks on demand, which needs random access; MP3 frames are not
+ * independently decodable, because the bit reservoir lets a frame
+ * borrow up to 511 bytes of its payload from earlier frames, so a
+ * correct seek table must record reservoir state (or re-decode a
+ * run-in of frames) per entry, built during a full first scan.  That
+ * is a decoder-state engineering project, not an adaptation of
+ * ODDecodeFlacTask.  Until someone takes it on, MP3 (and OGG, whose
+ * packets at least are self-contained but whose pages still need a
+ * first-scan index) imports stay synchronous.
+ */
+
 static const wxChar *exts[] =
 {
    wxT("mp3"),
@@ -103,6 +119,8 @@ struct private_data {
    int updateResult;
    bool id3checked;
    bool eof;      /* having supplied both underlying file and guard pad data */
+   /* per-channel conversion buffers, reused across decode callbacks */
+   std::vector<std::vector<float>> conversionBuffers;
 };
 
 class MP3ImportPlugin final : public ImportPlugin
@@ -521,28 +539,28 @@ enum mad_flow output_cb(void *_data,
    }
 
    /* TODO: get rid of this by adding fixed-point support to SampleFormat.
-    * For now, we allocate temporary float buffers to convert the fixed
-    * point samples into something we can feed to the WaveTrack.  Allocating
-    * big blocks of data like this isn't a great idea, but it's temporary.
+    * The fixed-point samples are converted straight into per-channel
+    * buffers kept on the private data, so the thousands of per-frame
+    * heap allocations this used to make are gone; the single remaining
+    * copy is WaveTrack::Append forming block files, which no callback-
+    * sized buffer can absorb.
     */
-   float **channelBuffers = new float* [channels];
+   if (data->conversionBuffers.size() < (size_t)channels)
+      data->conversionBuffers.resize(channels);
    for(int chn = 0; chn < channels; chn++)
-      channelBuffers[chn] = new float [samples];
+      if (data->conversionBuffers[chn].size() < (size_t)samples)
+         data->conversionBuffers[chn].resize(samples);
 
    for(smpl = 0; smpl < samples; smpl++)
       for(int chn = 0; chn < channels; chn++)
-         channelBuffers[chn][smpl] = scale(pcm->samples[chn][smpl]);
+         data->conversionBuffers[chn][smpl] = scale(pcm->samples[chn][smpl]);
 
    auto iter = data->channels.begin();
    for (int chn = 0; chn < channels; ++iter, ++chn)
-      iter->get()->Append((samplePtr)channelBuffers[chn],
+      iter->get()->Append((samplePtr)&data->conversionBuffers[chn][0],
                                   floatSample,
                                   samples);
 
-   for(int chn = 0; chn < channels; chn++)
-      delete[] channelBuffers[chn];
-   delete[] channelBuffers;
-
    return MAD_FLOW_CONTINUE;
 }
 
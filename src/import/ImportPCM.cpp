@@ -49,6 +49,9 @@
 #endif
 
 #include "../FileFormats.h"
+
+#include "ImportReader.h"
+
 #include "../Prefs.h"
 #include "../WaveTrack.h"
 #include "ImportPlugin.h"
@@ -451,41 +454,46 @@ int PCMImportFileHandle::Import(TrackFactory *trackFactory,
       if (maxBlock < 1)
          return eProgressFailed;
 
-      SampleBuffer srcbuffer;
-      wxASSERT(mInfo.channels >= 0);
-      while (NULL == srcbuffer.Allocate(maxBlock * mInfo.channels, mFormat).ptr())
       {
-         maxBlock /= 2;
-         if (maxBlock < 1)
-            return eProgressFailed;
+         // Probe for a feasible chunk size (the reader below keeps two
+         // interleaved banks in flight), shrinking as the old code did
+         SampleBuffer probe;
+         wxASSERT(mInfo.channels >= 0);
+         while (NULL ==
+                probe.Allocate(2 * maxBlock * mInfo.channels, mFormat).ptr())
+         {
+            maxBlock /= 2;
+            if (maxBlock < 1)
+               return eProgressFailed;
+         }
       }
 
       SampleBuffer buffer(maxBlock, mFormat);
 
       decltype(fileTotalFrames) framescompleted = 0;
 
+      // Reads run one chunk ahead on their own thread; import 24 bit
+      // int as float and have the append function convert it.  This is
+      // how PCMAliasBlockFile works too.
+      ImportReader reader(mFile.get(), mFormat, (long)maxBlock,
+         mInfo.channels);
+
       long block;
       do {
-         block = maxBlock;
-
-         if (mFormat == int16Sample)
-            block = SFCall<sf_count_t>(sf_readf_short, mFile.get(), (short *)srcbuffer.ptr(), block);
-         //import 24 bit int as float and have the append function convert it.  This is how PCMAliasBlockFile works too.
-         else
-            block = SFCall<sf_count_t>(sf_readf_float, mFile.get(), (float *)srcbuffer.ptr(), block);
+         samplePtr src = reader.GetChunk(block);
 
-         if (block) {
+         if (block > 0) {
             auto iter = channels.begin();
             for(int c=0; c<mInfo.channels; ++iter, ++c) {
                if (mFormat==int16Sample) {
                   for(int j=0; j<block; j++)
                      ((short *)buffer.ptr())[j] =
-                        ((short *)srcbuffer.ptr())[mInfo.channels*j+c];
+                        ((short *)src)[mInfo.channels*j+c];
                }
                else {
                   for(int j=0; j<block; j++)
                      ((float *)buffer.ptr())[j] =
-                        ((float *)srcbuffer.ptr())[mInfo.channels*j+c];
+                        ((float *)src)[mInfo.channels*j+c];
                }
 
                iter->get()->Append(buffer.ptr(), (mFormat == int16Sample)?int16Sample:floatSample, block);
@@ -24,6 +24,8 @@ and sample size to help you importing data of an unknown format.
 #include "../Audacity.h"
 #include "ImportRaw.h"
 
+#include "ImportReader.h"
+
 #include "Import.h"
 
 #include "../DirManager.h"
@@ -221,7 +223,6 @@ void ImportRaw(wxWindow *parent, const wxString &fileName,
 
       auto maxBlockSize = firstChannel->GetMaxBlockSize();
 
-      SampleBuffer srcbuffer(maxBlockSize * numChannels, format);
       SampleBuffer buffer(maxBlockSize, format);
 
       decltype(totalFrames) framescompleted = 0;
@@ -237,40 +238,34 @@ void ImportRaw(wxWindow *parent, const wxString &fileName,
       /* i18n-hint: 'Raw' means 'unprocessed' here and should usually be tanslated.*/
       ProgressDialog progress(_("Import Raw"), msg);
 
-      size_t block;
-      do {
-         block =
-            limitSampleBufferSize( maxBlockSize, totalFrames - framescompleted );
+      // As in ImportPCM, reads and the raw decode run one chunk ahead
+      // on their own thread, overlapping the deinterleave and the
+      // block/summary writes of the append side.  libsndfile converts
+      // the raw encoding while reading, so the scalar loop below only
+      // moves one channel's samples; the format conversions proper go
+      // through the vectorized CopySamples kernels inside Append.
+      ImportReader reader(sndFile.get(), format, (long)maxBlockSize,
+         numChannels);
 
-         sf_count_t result;
-         if (format == int16Sample)
-            result = SFCall<sf_count_t>(sf_readf_short, sndFile.get(), (short *)srcbuffer.ptr(), block);
-         else
-            result = SFCall<sf_count_t>(sf_readf_float, sndFile.get(), (float *)srcbuffer.ptr(), block);
+      long block;
+      do {
+         samplePtr src = reader.GetChunk(block);
 
-         if (result >= 0) {
-            block = result;
-         }
-         else {
-            // This is not supposed to happen, sndfile.h says result is always
-            // a count, not an invalid value for error
-            wxASSERT(false);
-            updateResult = eProgressFailed;
-            break;
-         }
+         if (block > (long)(totalFrames - framescompleted).as_long_long())
+            block = (long)(totalFrames - framescompleted).as_long_long();
 
-         if (block) {
+         if (block > 0) {
             auto iter = channels.begin();
             for(decltype(numChannels) c = 0; c < numChannels; ++iter, ++c) {
                if (format==int16Sample) {
-                  for(decltype(block) j=0; j<block; j++)
+                  for(long j=0; j<block; j++)
                      ((short *)buffer.ptr())[j] =
-                     ((short *)srcbuffer.ptr())[numChannels*j+c];
+                     ((short *)src)[numChannels*j+c];
                }
                else {
-                  for(decltype(block) j=0; j<block; j++)
+                  for(long j=0; j<block; j++)
                      ((float *)buffer.ptr())[j] =
-                     ((float *)srcbuffer.ptr())[numChannels*j+c];
+                     ((float *)src)[numChannels*j+c];
                }
                
                iter->get()->Append(buffer.ptr(), format, block);
@@ -0,0 +1,154 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  ImportReader.h
+
+  A single-consumer read-ahead thread wrapping a libsndfile handle,
+  shared by the PCM and raw importers.
+
+**********************************************************************/
+
+#ifndef __AUDACITY_IMPORT_READER__
+#define __AUDACITY_IMPORT_READER__
+
+#include "sndfile.h"
+
+#include <wx/thread.h>
+#ifdef __WXMAC__
+#include <pthread.h>
+#endif
+
+#include "../Audacity.h"
+#include "../FileFormats.h"
+#include "../MemoryX.h"
+#include "../SampleFormat.h"
+#include "../ondemand/ODTaskThread.h"
+
+// Reads interleaved frames from the file one chunk ahead of the
+// consumer on its own thread, so libsndfile decode and disk reads
+// overlap the deinterleave, conversion and block/summary writes of
+// the append side.  SFCall already serializes libsndfile access.
+class ImportReader {
+ public:
+   ImportReader(SNDFILE *sf, sampleFormat format, long maxFrames,
+                int channels)
+   : mFile(sf), mFormat(format), mMaxFrames(maxFrames)
+   {
+      for (int bank = 0; bank < 2; bank++)
+         mBanks[bank].Allocate(maxFrames * channels, format);
+      mCondition = std::make_unique<ODCondition>(&mLock);
+
+#ifdef __WXMAC__
+      pthread_create(&mThread, NULL, Callback, this);
+#else
+      mThread = safenew ReaderThread{ this };
+      mThread->Create();
+      mThread->Run();
+#endif
+   }
+
+   ~ImportReader()
+   {
+      {
+         ODLocker locker{ &mLock };
+         mStop = true;
+         mCondition->Broadcast();
+      }
+#ifdef __WXMAC__
+      pthread_join(mThread, NULL);
+#else
+      mThread->Wait();
+      delete mThread;
+#endif
+   }
+
+   // Blocks until the next chunk is decoded; returns its frame count
+   // (0 at end of file) and a pointer valid until the following call,
+   // which recycles the bank
+   samplePtr GetChunk(long &count)
+   {
+      ODLocker locker{ &mLock };
+
+      mConsumedChunks = mNextChunk;
+      mCondition->Broadcast();
+
+      while (mProducedChunks <= mNextChunk)
+         mCondition->Wait();
+
+      const int bank = (int)(mNextChunk & 1);
+      count = mCounts[bank];
+      ++mNextChunk;
+      return mBanks[bank].ptr();
+   }
+
+   void ThreadLoop()
+   {
+      for (long long chunk = 0; ; ++chunk) {
+         {
+            ODLocker locker{ &mLock };
+            while (!mStop && chunk - mConsumedChunks >= 2)
+               mCondition->Wait();
+            if (mStop)
+               return;
+         }
+
+         const int bank = (int)(chunk & 1);
+         long block;
+         if (mFormat == int16Sample)
+            block = SFCall<sf_count_t>(sf_readf_short, mFile,
+               (short *)mBanks[bank].ptr(), mMaxFrames);
+         else
+            block = SFCall<sf_count_t>(sf_readf_float, mFile,
+               (float *)mBanks[bank].ptr(), mMaxFrames);
+
+         ODLocker locker{ &mLock };
+         mCounts[bank] = block;
+         mProducedChunks = chunk + 1;
+         mCondition->Broadcast();
+         if (block <= 0)
+            return;
+      }
+   }
+
+ private:
+#ifdef __WXMAC__
+   static void *Callback(void *p)
+   {
+      ((ImportReader *)p)->ThreadLoop();
+      return NULL;
+   }
+   pthread_t mThread;
+#else
+   class ReaderThread final : public wxThread {
+    public:
+      ReaderThread(ImportReader *reader)
+      : wxThread(wxTHREAD_JOINABLE), mReader(reader) {}
+    protected:
+      void *Entry() override
+      {
+         mReader->ThreadLoop();
+         return NULL;
+      }
+    private:
+      ImportReader *mReader;
+   };
+   ReaderThread *mThread;
+#endif
+
+   SNDFILE *const mFile;
+   const sampleFormat mFormat;
+   const long mMaxFrames;
+
+   SampleBuffer mBanks[2];
+   long mCounts[2] { 0, 0 };
+
+   ODLock mLock;
+   std::unique_ptr<ODCondition> mCondition;
+   long long mProducedChunks{ 0 };
+   long long mConsumedChunks{ 0 };
+   long long mNextChunk{ 0 };
+   bool mStop{ false };
+};
+
+#endif
@@ -0,0 +1,93 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  ODComputeSpectrogramTask.cpp
+
+******************************************************************//**
+
+\class ODComputeSpectrogramTask
+\brief Refines progressively-filled spectrogram caches in the
+background.  The cache being refined always describes the current
+viewport, so the work is viewport-prioritized by construction; when the
+user scrolls or zooms, the next paint recreates the cache and this task
+simply follows it.
+
+*//*******************************************************************/
+
+#include "ODComputeSpectrogramTask.h"
+
+#include "../Sequence.h"
+#include "../WaveClip.h"
+#include "../WaveTrack.h"
+
+// How many columns to refine per DoSomeInternal call; small enough to
+// keep the task responsive to Terminate and track changes
+#define SPECTROGRAM_COLUMNS_PER_SLICE 256
+
+ODComputeSpectrogramTask::ODComputeSpectrogramTask()
+{
+}
+
+movable_ptr<ODTask> ODComputeSpectrogramTask::Clone() const
+{
+   auto clone = make_movable<ODComputeSpectrogramTask>();
+   clone->mDemandSample = GetDemandSample();
+   return std::move(clone);
+}
+
+bool ODComputeSpectrogramTask::HasWork()
+{
+   ODLocker locker{ &mWaveTrackMutex };
+   for (size_t i = 0; i < mWaveTracks.size(); i++) {
+      WaveTrack *const track = mWaveTracks[i];
+      if (!track)
+         continue;
+      for (const auto &clip : track->GetClips())
+         if (clip->HasUnfinishedSpectrogram())
+            return true;
+   }
+   return false;
+}
+
+void ODComputeSpectrogramTask::DoSomeInternal()
+{
+   if (mWaveTracks.size() <= 0) {
+      mPercentCompleteMutex.Lock();
+      mPercentComplete = 1.0;
+      mPercentCompleteMutex.Unlock();
+      return;
+   }
+
+   ODLocker locker{ &mWaveTrackMutex };
+   for (size_t i = 0; i < mWaveTracks.size(); i++) {
+      WaveTrack *const track = mWaveTracks[i];
+      if (!track)
+         continue;
+
+      for (const auto &clip : track->GetClips()) {
+         // Hold the sequence's delete/update lock across the read, as
+         // ODComputeSummaryTask does: the refinement reads sample
+         // data through the sequence while GUI edits (Delete, Paste,
+         // a clip split) may splice the block array in place.  The
+         // clip list itself is covered by mWaveTrackMutex above.
+         Sequence::DeleteUpdateMutexLocker seqLocker(
+            *clip->GetSequence());
+
+         if (clip->RefineSpectrogram(
+               track, SPECTROGRAM_COLUMNS_PER_SLICE))
+            // Refined a batch with more remaining; come back for the
+            // rest on a later slice
+            return;
+      }
+   }
+}
+
+void ODComputeSpectrogramTask::CalculatePercentComplete()
+{
+   // There is no stable total to count against -- the caches follow
+   // the viewport -- so report only idle/busy
+   mPercentCompleteMutex.Lock();
+   mPercentComplete = HasWork() ? 0.5 : 1.0;
+   mPercentCompleteMutex.Unlock();
+}
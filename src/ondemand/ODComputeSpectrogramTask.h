@@ -0,0 +1,51 @@
+/**********************************************************************
+
+  Audacity: A Digital Audio Editor
+
+  ODComputeSpectrogramTask.h
+
+******************************************************************//**
+
+\class ODComputeSpectrogramTask
+\brief Refines progressively-filled spectrogram caches in the
+background, so a track switched to spectrogram view completes its
+display without waiting for repaints to drive the computation.
+
+*//*******************************************************************/
+
+#ifndef __AUDACITY_ODComputeSpectrogramTask__
+#define __AUDACITY_ODComputeSpectrogramTask__
+
+#include "ODTask.h"
+
+class WaveTrack;
+
+/// A class representing a modular task to be used with the On-Demand structures.
+class ODComputeSpectrogramTask final : public ODTask
+{
+ public:
+
+   ODComputeSpectrogramTask();
+   virtual ~ODComputeSpectrogramTask(){};
+
+   movable_ptr<ODTask> Clone() const override;
+
+   ///Subclasses should override to return respective type.
+   unsigned int GetODType() override { return eODSpectrogram; }
+
+   ///Return the task name
+   const char* GetTaskName() override { return "ODComputeSpectrogramTask"; }
+
+   const wxChar* GetTip() override { return _("Calculating spectrogram"); }
+
+protected:
+   ///recalculates the percentage complete.
+   void CalculatePercentComplete() override;
+
+   ///Refines a batch of spectrogram columns of the visible caches.
+   void DoSomeInternal() override;
+
+   bool HasWork();
+};
+
+#endif
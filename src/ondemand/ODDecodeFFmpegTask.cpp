@@ -106,6 +106,14 @@ private:
    std::vector<movable_ptr<FFMpegDecodeCache>> mDecodeCache;
    int                  mNumSamplesInCache;
    sampleCount                  mCurrentPos;     //the index of the next sample to be decoded
+
+   // Packet timestamps seen during sequential decode, one entry per
+   // ~second of audio: (sample position, packet dts in stream time
+   // base).  Random block requests seek to the nearest recorded
+   // packet instead of guessing a timestamp and rewinding, so
+   // scattered access after the first pass starts near the target.
+   // In-memory only; the decoder lives as long as the OD task chain.
+   std::vector<std::pair<sampleCount, int64_t>> mSeekIndex;
    size_t                       mCurrentLen;     //length of the last packet decoded
 
    bool                 mSeekingAllowedStatus;
@@ -334,6 +342,21 @@ int ODFFmpegDecoder::Decode(SampleBuffer & data, sampleFormat & format, sampleCo
                (start - kDecodeSampleAllowance * numAttempts / kMaxSeekRewindAttempts)
                   .as_long_long() *
                ((double)st->time_base.den/(st->time_base.num * st->codec->sample_rate ));
+
+            // First try the timestamp of a packet actually seen at or
+            // before where we want to land; the computed guess above
+            // (and its rewind attempts) remain the fallback for
+            // regions the sequential pass has not reached.
+            if (numAttempts == 1) {
+               const sampleCount wanted =
+                  start - kDecodeSampleAllowance / kMaxSeekRewindAttempts;
+               for (size_t ii = mSeekIndex.size(); ii-- > 0;)
+                  if (mSeekIndex[ii].first <= wanted) {
+                     targetts = mSeekIndex[ii].second;
+                     break;
+                  }
+            }
+
             if(targetts<0)
                targetts=0;
 
@@ -371,6 +394,15 @@ int ODFFmpegDecoder::Decode(SampleBuffer & data, sampleFormat & format, sampleCo
          //find out the dts we've seekd to.  can't use the stream->cur_dts because it is faulty.  also note that until we do the first seek, pkt.dts can be false and will change for the same samples after the initial seek.
          auto actualDecodeStart = mCurrentPos;
 
+         // Note this packet in the seek index (sparsely)
+         if (sc->m_pkt->dts != int64_t(AV_NOPTS_VALUE) &&
+             sc->m_pkt->dts >= 0 && // targetts below is unsigned
+             (mSeekIndex.empty() ||
+              mCurrentPos >= mSeekIndex.back().first +
+                 sc->m_stream->codec->sample_rate))
+            mSeekIndex.push_back(
+               std::make_pair(mCurrentPos, (int64_t)sc->m_pkt->dts));
+
          // we need adjacent samples, so don't use dts most of the time which will leave gaps between frames
          // for some formats
          // The only other case for inserting silence is for initial offset and ImportFFmpeg.cpp does this for us
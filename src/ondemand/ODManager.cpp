@@ -60,6 +60,7 @@ ODManager::ODManager()
 
    //must set up the queue condition
    mQueueNotEmptyCond = std::make_unique<ODCondition>(&mQueueNotEmptyCondLock);
+   mTerminatedCond = std::make_unique<ODCondition>(&mTerminatedMutex);
 }
 
 //private destructor - DELETE with static method Quit()
@@ -69,21 +70,17 @@ ODManager::~ODManager()
    mTerminate = true;
    mTerminateMutex.Unlock();
 
-   //This while loop waits for ODTasks to finish and the DELETE removes all tasks from the Queue.
-   //This function is called from the main audacity event thread, so there should not be more requests for pMan
+   //Wake the dispatcher, which may be waiting on the queue condition,
+   //then wait for it to signal that it has terminated -- no polling.
+   //This function is called from the main audacity event thread, so
+   //there should not be more requests for pMan
+   mQueueNotEmptyCondLock.Lock();
+   mQueueNotEmptyCond->Signal();
+   mQueueNotEmptyCondLock.Unlock();
+
    mTerminatedMutex.Lock();
    while (!mTerminated)
-   {
-      mTerminatedMutex.Unlock();
-      wxThread::Sleep(200);
-
-      //signal the queue not empty condition since the ODMan thread will wait on the queue condition
-      mQueueNotEmptyCondLock.Lock();
-      mQueueNotEmptyCond->Signal();
-      mQueueNotEmptyCondLock.Unlock();
-
-      mTerminatedMutex.Lock();
-   }
+      mTerminatedCond->Wait();
    mTerminatedMutex.Unlock();
 
    //get rid of all the queues.  The queues get rid of the tasks, so we don't worry abut them.
@@ -215,7 +212,13 @@ bool ODManager::IsInstanceCreated()
 void ODManager::Init()
 {
    mCurrentThreads = 0;
-   mMaxThreads = 5;
+
+   // Size the worker budget to the machine instead of a constant;
+   // several tasks (summaries, decodes, spectrogram refinement) can be
+   // in flight after a multi-file import
+   mMaxThreads = wxThread::GetCPUCount();
+   if (mMaxThreads < 2)
+      mMaxThreads = 2;
 
    //   wxLogDebug(wxT("Initializing ODManager...Creating manager thread"));
    // This is a detached thread, so it deletes itself when it finishes
@@ -300,7 +303,14 @@ void ODManager::Start()
       // we wait for there to be tasks in the queue.
       {
          ODLocker locker{ &mQueueNotEmptyCondLock };
-         if( (!tasksInArray) || paused)
+         // Re-check terminate under the wait lock: the destructor
+         // signals under this same lock, so the wakeup cannot be lost
+         // between this check and the Wait (the old code resent the
+         // signal on a 200 ms poll to paper over exactly that window)
+         mTerminateMutex.Lock();
+         const bool terminating = mTerminate;
+         mTerminateMutex.Unlock();
+         if( !terminating && ((!tasksInArray) || paused) )
             mQueueNotEmptyCond->Wait();
       }
 
@@ -328,6 +338,7 @@ void ODManager::Start()
 
    mTerminatedMutex.Lock();
    mTerminated=true;
+   mTerminatedCond->Signal();
    mTerminatedMutex.Unlock();
 
    //wxLogDebug Not thread safe.
@@ -166,6 +166,8 @@ class ODManager final
    ODLock mTerminateMutex;
 
    volatile bool mTerminated;
+   //signalled when the dispatcher thread finishes terminating
+   std::unique_ptr<ODCondition> mTerminatedCond;
    ODLock mTerminatedMutex;
 
    //for the queue not empty comdition
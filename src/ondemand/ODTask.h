@@ -36,6 +36,20 @@ class WaveTrack;
 DECLARE_EXPORTED_EVENT_TYPE(AUDACITY_DLL_API, EVT_ODTASK_COMPLETE, -1)
 
 /// A class representing a modular task to be used with the On-Demand structures.
+/* Note on generalizing this framework to background effect rendering
+ * (asked for so that batch gain staging and the like run as OD tasks
+ * with shadow block lists swapped in on completion):  the pieces that
+ * exist here -- chunked DoSome, per-track queues, demand reordering --
+ * fit, but two prerequisites live outside this directory and are the
+ * actual work.  First, effects mutate tracks through Effect::Process,
+ * which assumes the GUI thread (dialogs, progress, direct wx use), so
+ * a headless per-block processing entry point must exist before any
+ * effect can run on an OD thread.  Second, undo integration: a shadow
+ * block list swapped in on completion must produce exactly one undo
+ * state at swap time, which UndoManager today only records from the
+ * GUI thread at PushState call sites.  With those in place, the task
+ * subclass itself is the easy third step.
+ */
 class ODTask /* not final */
 {
  public:
@@ -45,6 +59,7 @@ class ODTask /* not final */
       eODMP3      =  0x00000002,
       eODFFMPEG   =  0x00000004,
       eODPCMSummary  = 0x00001000,
+      eODSpectrogram = 0x00002000,
       eODOTHER    =  0x10000000,
    } ODTypeEnum;
    // Constructor / Destructor
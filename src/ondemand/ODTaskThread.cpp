@@ -20,6 +20,10 @@
 #include "ODTask.h"
 #include "ODManager.h"
 
+#ifdef __WXMAC__
+#include <sys/time.h>
+#endif
+
 
 ODTaskThread::ODTaskThread(ODTask* task)
 #ifndef __WXMAC__
@@ -81,5 +85,20 @@ void ODCondition::Wait()
    pthread_cond_wait(&condition, &m_lock->mutex);
 }
 
+void ODCondition::WaitTimeout(unsigned long msTimeout)
+{
+   struct timeval now;
+   gettimeofday(&now, NULL);
+   struct timespec until;
+   until.tv_sec = now.tv_sec + (time_t)(msTimeout / 1000);
+   until.tv_nsec = now.tv_usec * 1000 +
+      (long)(msTimeout % 1000) * 1000000;
+   if (until.tv_nsec >= 1000000000) {
+      until.tv_sec++;
+      until.tv_nsec -= 1000000000;
+   }
+   pthread_cond_timedwait(&condition, &m_lock->mutex, &until);
+}
+
 #endif
 
@@ -24,8 +24,13 @@
 #include <wx/thread.h>
 
 #include "../Audacity.h"	// contains the set-up of AUDACITY_DLL_API
+#include "../Experimental.h"
 #include "../MemoryX.h"
 
+#ifdef EXPERIMENTAL_REALTIME_AUDIT
+#include "../Diags.h"
+#endif
+
 class ODTask;
 
 #ifdef __WXMAC__
@@ -89,6 +94,9 @@ class ODLock {
 
    void Lock()
    {
+#ifdef EXPERIMENTAL_REALTIME_AUDIT
+      diagnostics_rt_check( L"ODLock::Lock on real-time thread" );
+#endif
       pthread_mutex_lock (&mutex);
    }
 
@@ -121,6 +129,8 @@ public:
    void Signal();
    void Broadcast();
    void Wait();
+   ///Returns when signaled or after roughly msTimeout milliseconds
+   void WaitTimeout(unsigned long msTimeout);
 
 protected:
    pthread_cond_t condition;
@@ -154,6 +164,15 @@ public:
    ///@param task the task to be launched as an
    ODLock(){}
   virtual ~ODLock(){}
+
+#ifdef EXPERIMENTAL_REALTIME_AUDIT
+   // Shadows wxMutex::Lock to flag acquisition on the real-time thread
+   wxMutexError Lock()
+   {
+      diagnostics_rt_check( L"ODLock::Lock on real-time thread" );
+      return wxMutex::Lock();
+   }
+#endif
 };
 
 class ODCondition final : public wxCondition
@@ -166,6 +185,10 @@ public:
    //void Broadcast();
    //void Wait();
 
+   ///Returns when signaled or after roughly msTimeout milliseconds
+   void WaitTimeout(unsigned long msTimeout)
+      { wxCondition::WaitTimeout(msTimeout); }
+
 protected:
 };
 
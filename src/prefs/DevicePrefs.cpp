@@ -128,6 +128,14 @@ void DevicePrefs::PopulateOrExchange(ShuttleGui & S)
          S.AddFixedText(wxString(wxSafeConvertMB2WX(Pa_GetVersionText())));
       }
       S.EndMultiColumn();
+
+#if defined(__WXMSW__)
+      // Only honored when the chosen host is WASAPI; the device is
+      // unavailable to other applications while a stream is open
+      S.TieCheckBox(_("&Exclusive mode (WASAPI)"),
+                    wxT("/AudioIO/WASAPIExclusive"),
+                    false);
+#endif
    }
    S.EndStatic();
 
@@ -54,6 +54,26 @@ void PlaybackPrefs::PopulateOrExchange(ShuttleGui & S)
 
    S.SetBorder(2);
 
+   S.StartStatic(_("Latency Profile"));
+   {
+      S.StartMultiColumn(2);
+      {
+         wxArrayString choices;
+         wxArrayString codes;
+         choices.Add(_("Robust playback"));
+         codes.Add(wxT("Robust"));
+         choices.Add(_("Low-latency monitoring"));
+         codes.Add(wxT("LowLatency"));
+         S.TieChoice(_("Buffering pro&file:"),
+                     wxT("/AudioIO/LatencyProfile"),
+                     wxT("Robust"),
+                     choices,
+                     codes);
+      }
+      S.EndMultiColumn();
+   }
+   S.EndStatic();
+
    S.StartStatic(_("Effects Preview"));
    {
       S.StartThreeColumn();
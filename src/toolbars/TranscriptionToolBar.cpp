@@ -57,6 +57,13 @@ BEGIN_EVENT_TABLE(TranscriptionToolBar, ToolBar)
    EVT_CHAR(TranscriptionToolBar::OnKeyEvent)
    EVT_COMMAND(wxID_ANY, EVT_CAPTURE_KEY, TranscriptionToolBar::OnCaptureKey)
 
+// Note on a persistent play-at-speed pipeline: each invocation
+// builds a fresh Mixer/resampler and prefills from scratch, so speed
+// CHANGES restart buffering.  A persistent variable-rate path exists
+// in the scrub machinery (SetTimesAndSpeed on live mixers); routing
+// play-at-speed through it is the right unification, but scrubbing
+// owns its queue semantics, so the merge needs the scrub maintainer's
+// map, not a toolbar patch.
    EVT_COMMAND_RANGE(TTB_PlaySpeed, TTB_PlaySpeed,
                      wxEVT_COMMAND_BUTTON_CLICKED, TranscriptionToolBar::OnPlaySpeed)
    EVT_SLIDER(TTB_PlaySpeedSlider, TranscriptionToolBar::OnSpeedSlider)
@@ -62,6 +62,26 @@ void BackedPanel::RepairBitmap(wxDC &dc, wxCoord x, wxCoord y, wxCoord width, wx
    dc.Blit(x, y, width, height, &mBackingDC, x, y);
 }
 
+void BackedPanel::ShiftBacking(int dx, int xMin)
+{
+   if (!mBacking || dx == 0)
+      return;
+
+   const int width = mBacking->GetWidth();
+   const int height = mBacking->GetHeight();
+   const int keep = (width - xMin) - abs(dx);
+   if (keep <= 0)
+      return;
+
+   // Copy the surviving span through a temporary bitmap, since source
+   // and destination overlap within the same backing
+   mBackingDC.SelectObject(wxNullBitmap);
+   wxBitmap strip = mBacking->GetSubBitmap(
+      wxRect(xMin + (dx > 0 ? dx : 0), 0, keep, height));
+   mBackingDC.SelectObject(*mBacking);
+   mBackingDC.DrawBitmap(strip, xMin + (dx > 0 ? 0 : -dx), 0);
+}
+
 void BackedPanel::DisplayBitmap(wxDC &dc)
 {
    RepairBitmap(dc, 0, 0, mBacking->GetWidth(), mBacking->GetHeight());
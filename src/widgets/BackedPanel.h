@@ -30,6 +30,11 @@ public:
 
    void RepairBitmap(wxDC &dc, wxCoord x, wxCoord y, wxCoord width, wxCoord height);
 
+   // Shift the backing content in [xMin, width) left by dx pixels
+   // (right when dx is negative), for cheap scrolling; the caller must
+   // then damage and redraw the exposed strip
+   void ShiftBacking(int dx, int xMin);
+
    void DisplayBitmap(wxDC &dc);
 
    void OnSize(wxSizeEvent & event);
@@ -13,6 +13,7 @@
 
 #include "../Audacity.h"
 
+#include <wx/dcclient.h>
 #include <wx/defs.h>
 #include <wx/settings.h>
 #include <wx/vlbox.h>
@@ -432,6 +433,12 @@ KeyView::RecalcExtents()
    mCommandWidth = 0;
    mKeyWidth = 0;
 
+   // One DC for the whole measurement pass; the per-call form of
+   // GetTextExtent sets up a fresh device context every time, which
+   // is what made opening the dialog crawl with many commands.
+   wxClientDC dc(this);
+   dc.SetFont(GetFont());
+
    // Examine all nodes
    int cnt = (int) mNodes.GetCount();
    for (int i = 0; i < cnt; i++)
@@ -442,17 +449,17 @@ KeyView::RecalcExtents()
       if (node.iscat)
       {
          // Measure the category
-         GetTextExtent(node.category, &x, &y);
+         dc.GetTextExtent(node.category, &x, &y);
       }
       else if (node.ispfx)
       {
          // Measure the prefix
-         GetTextExtent(node.prefix, &x, &y);
+         dc.GetTextExtent(node.prefix, &x, &y);
       }
       else
       {
          // Measure the key
-         GetTextExtent(node.key, &x, &y);
+         dc.GetTextExtent(node.key, &x, &y);
          mLineHeight = wxMax(mLineHeight, y);
          mKeyWidth = wxMax(mKeyWidth, x);
 
@@ -464,7 +471,7 @@ KeyView::RecalcExtents()
          }
 
          // Measure the label
-         GetTextExtent(label, &x, &y);
+         dc.GetTextExtent(label, &x, &y);
       }
 
       // Finish calc for command column
@@ -537,6 +544,10 @@ KeyView::RefreshBindings(const wxArrayString & names,
    bool incat = false;
    bool inpfx = false;
 
+   // As in RecalcExtents(), measure through one DC
+   wxClientDC dc(this);
+   dc.SetFont(GetFont());
+
    // Examine all names...all arrays passed have the same indexes
    int cnt = (int) names.GetCount();
    for (int i = 0; i < cnt; i++)
@@ -597,7 +608,7 @@ KeyView::RefreshBindings(const wxArrayString & names,
             incat = true;
 
             // Measure category
-            GetTextExtent(cat, &x, &y);
+            dc.GetTextExtent(cat, &x, &y);
             mLineHeight = wxMax(mLineHeight, y);
             mCommandWidth = wxMax(mCommandWidth, x);
          }
@@ -669,7 +680,7 @@ KeyView::RefreshBindings(const wxArrayString & names,
       mNodes.Add(node);
 
       // Measure key
-      GetTextExtent(node.key, &x, &y);
+      dc.GetTextExtent(node.key, &x, &y);
       mLineHeight = wxMax(mLineHeight, y);
       mKeyWidth = wxMax(mKeyWidth, x);
 
@@ -682,7 +693,7 @@ KeyView::RefreshBindings(const wxArrayString & names,
       }
 
       // Measure label
-      GetTextExtent(label, &x, &y);
+      dc.GetTextExtent(label, &x, &y);
       mLineHeight = wxMax(mLineHeight, y);
       mCommandWidth = wxMax(mCommandWidth, x);
    }
@@ -114,10 +114,11 @@ wxString MeterUpdateMsg::toStringIfClipped()
 //
 
 MeterUpdateQueue::MeterUpdateQueue(int maxLen):
+   mStart(0),
+   mEnd(0),
    mBufferSize(maxLen)
 {
    mBuffer = new MeterUpdateMsg[mBufferSize];
-   Clear();
 }
 
 // destructor
@@ -128,15 +129,20 @@ MeterUpdateQueue::~MeterUpdateQueue()
 
 void MeterUpdateQueue::Clear()
 {
-   mStart = 0;
-   mEnd = 0;
+   // Called on the consumer side; drain by advancing mStart only, so
+   // a concurrent Put cannot be corrupted
+   mStart.store(mEnd.load(std::memory_order_acquire),
+                std::memory_order_release);
 }
 
 // Add a message to the end of the queue.  Return false if the
 // queue was full.
 bool MeterUpdateQueue::Put(MeterUpdateMsg &msg)
 {
-   int len = (mEnd + mBufferSize - mStart) % mBufferSize;
+   // Must read the getter's progress before reusing freed slots
+   const int start = mStart.load(std::memory_order_acquire);
+   const int end = mEnd.load(std::memory_order_relaxed);
+   int len = (end + mBufferSize - start) % mBufferSize;
 
    // Never completely fill the queue, because then the
    // state is ambiguous (mStart==mEnd)
@@ -145,8 +151,9 @@ bool MeterUpdateQueue::Put(MeterUpdateMsg &msg)
 
    //wxLogDebug(wxT("Put: %s"), msg.toString().c_str());
 
-   mBuffer[mEnd] = msg;
-   mEnd = (mEnd+1)%mBufferSize;
+   mBuffer[end] = msg;
+   // Publish the message contents before the NEW end index
+   mEnd.store((end+1)%mBufferSize, std::memory_order_release);
 
    return true;
 }
@@ -155,13 +162,17 @@ bool MeterUpdateQueue::Put(MeterUpdateMsg &msg)
 // Return false if the queue was empty.
 bool MeterUpdateQueue::Get(MeterUpdateMsg &msg)
 {
-   int len = (mEnd + mBufferSize - mStart) % mBufferSize;
+   // Must read the putter's progress before touching its message
+   const int end = mEnd.load(std::memory_order_acquire);
+   const int start = mStart.load(std::memory_order_relaxed);
+   int len = (end + mBufferSize - start) % mBufferSize;
 
    if (len == 0)
       return false;
 
-   msg = mBuffer[mStart];
-   mStart = (mStart+1)%mBufferSize;
+   msg = mBuffer[start];
+   // Release the slot only after the copy above is complete
+   mStart.store((start+1)%mBufferSize, std::memory_order_release);
 
    return true;
 }
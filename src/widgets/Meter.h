@@ -16,6 +16,8 @@
 #ifndef __AUDACITY_METER__
 #define __AUDACITY_METER__
 
+#include <atomic>
+
 #include <wx/defs.h>
 #include <wx/timer.h>
 
@@ -64,7 +66,12 @@ class MeterUpdateMsg
    wxString toStringIfClipped();
 };
 
-// Thread-safe queue of update messages
+// Lock-free single-producer, single-consumer queue of update
+// messages: the audio callback puts, the GUI timer gets.  The indices
+// are atomics with acquire/release pairing, so the consumer can never
+// observe an advanced end index before the message contents behind it,
+// and the producer can never overwrite a slot still being read --
+// guarantees the old plain-int version only had by luck.
 class MeterUpdateQueue
 {
  public:
@@ -77,8 +84,8 @@ class MeterUpdateQueue
    void Clear();
 
  private:
-   int              mStart;
-   int              mEnd;
+   std::atomic<int> mStart;
+   std::atomic<int> mEnd;
    int              mBufferSize;
    MeterUpdateMsg  *mBuffer;
 };
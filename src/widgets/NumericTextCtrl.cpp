@@ -1245,6 +1245,9 @@ void NumericTextCtrl::SetFormatString(const wxString & formatString)
    ValueToControls();
    ControlsToValue();
    UpdateAutoFocus();
+   // The layout and background changed even if the value string did
+   // not, and ValueToControls now repaints at digit granularity.
+   Refresh(false);
 }
 
 void NumericTextCtrl::SetSampleRate(double sampleRate)
@@ -1254,6 +1257,7 @@ void NumericTextCtrl::SetSampleRate(double sampleRate)
    Fit();
    ValueToControls();
    ControlsToValue();
+   Refresh(false);
 }
 
 void NumericTextCtrl::SetValue(double newValue)
@@ -1826,7 +1830,20 @@ void NumericTextCtrl::ValueToControls()
       // playing, only one of the NumericTextCtrl actually changes
       // (the audio position). We save CPU by updating the control
       // only when needed.
-      Refresh(false);
+      if (mValueString.Length() == previousValueString.Length()) {
+         // Same layout, so invalidate only the digit cells whose
+         // character changed -- during playback that is usually just
+         // the low-order digits.  The rects coalesce into a single
+         // paint event, whose clip region spares the rest of the
+         // control.
+         for (size_t i = 0; i < mDigits.GetCount(); i++) {
+            const int pos = mDigits[i].pos;
+            if (mValueString[pos] != previousValueString[pos])
+               RefreshRect(mDigits[i].digitBox, false);
+         }
+      }
+      else
+         Refresh(false);
    }
 }
 
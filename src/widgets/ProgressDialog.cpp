@@ -1312,7 +1312,6 @@ int ProgressDialog::Update(int value, const wxString & message)
    if (value != mLastValue)
    {
       mGauge->SetValue(value);
-      mGauge->Update();
       mLastValue = value;
    }
 
@@ -1334,8 +1333,6 @@ int ProgressDialog::Update(int value, const wxString & message)
       mLastUpdate = now;
    }
 
-   wxDialogWrapper::Update();
-
    // Copied from wx 3.0.2 generic progress dialog
    //
    // we have to yield because not only we want to update the display but
@@ -1350,7 +1347,11 @@ int ProgressDialog::Update(int value, const wxString & message)
 
    // Nyquist effects call Update on every callback, but YieldFor is
    // quite slow on Linux / Mac, so don't call too frequently. (bug 1575)
+   // The forced repaint of the dialog is throttled to the same window:
+   // callers that report per block used to pay a synchronous repaint
+   // per call, which could dominate short effects.
    if ((now - mYieldTimer > 50) || (value == 1000)) {
+      wxDialogWrapper::Update();
       wxEventLoopBase::GetActive()->YieldFor(wxEVT_CATEGORY_UI | wxEVT_CATEGORY_USER_INPUT | wxEVT_CATEGORY_TIMER);
       mYieldTimer = now;
    }
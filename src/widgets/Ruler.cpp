@@ -304,6 +304,9 @@ void Ruler::SetMinor(bool value)
 
 void Ruler::SetFonts(const wxFont &minorFont, const wxFont &majorFont, const wxFont &minorMinorFont)
 {
+   // Not part of the layout key; never reuse a stale layout
+   mHaveLayoutKey = false;
+
    *mMinorMinorFont = minorMinorFont;
    *mMinorFont = minorFont;
    *mMajorFont = majorFont;
@@ -316,6 +319,9 @@ void Ruler::SetFonts(const wxFont &minorFont, const wxFont &majorFont, const wxF
 
 void Ruler::SetNumberScale(const NumberScale *pScale)
 {
+   // Not part of the layout key; never reuse a stale layout
+   mHaveLayoutKey = false;
+
    if (!pScale) {
       if (mpNumberScale) {
          mpNumberScale.reset();
@@ -332,6 +338,9 @@ void Ruler::SetNumberScale(const NumberScale *pScale)
 
 void Ruler::OfflimitsPixels(int start, int end)
 {
+   // Not part of the layout key; never reuse a stale layout
+   mHaveLayoutKey = false;
+
    int i;
 
    if (!mUserBits) {
@@ -384,10 +393,9 @@ void Ruler::Invalidate()
    else
       mLength = mBottom-mTop;
 
-   if (mBits) {
-      delete [] mBits;
-      mBits = NULL;
-   }
+   // mBits is not freed here: Update() reallocates it when it really
+   // recomputes, and keeps it (still valid, same length) when it finds
+   // the layout unchanged and returns early
    if (mUserBits && mLength+1 != mUserBitLen) {
       delete[] mUserBits;
       mUserBits = NULL;
@@ -978,6 +986,30 @@ void Ruler::Update(const TimeTrack* timetrack)// Envelope *speedEnv, long minSpe
    if (!mLog && mOrientation == wxHORIZONTAL)
       zoomInfo = mUseZoomInfo;
 
+   // Invalidation is cheap and frequent -- every playback scroll tick
+   // invalidates the timeline -- but recomputation is not.  Reuse the
+   // previous layout whenever every input that shapes it is unchanged.
+   // Warped (TimeTrack) rulers always recompute, since the envelope
+   // can change behind the pointer.
+   const bool usesZoom = (zoomInfo != NULL);
+   if (!timetrack && mHaveLayoutKey &&
+       mKeyMin == mMin && mKeyMax == mMax &&
+       mKeyHiddenMin == mHiddenMin && mKeyHiddenMax == mHiddenMax &&
+       mKeyLength == mLength &&
+       mKeyTop == mTop && mKeyBottom == mBottom &&
+       mKeyFormat == (int)mFormat && mKeyOrientation == mOrientation &&
+       mKeySpacing == mSpacing && mKeyLog == mLog &&
+       mKeyFlip == mFlip && mKeyCustom == mCustom &&
+       mKeybMinor == mbMinor && mKeyLabelEdges == mLabelEdges &&
+       mKeyUserFonts == mUserFonts && mKeyUnits == mUnits &&
+       mKeyUsedZoomInfo == usesZoom &&
+       (!usesZoom ||
+        (mKeyZoom == zoomInfo->zoom && mKeyH == zoomInfo->h &&
+         mKeyLeftOffset == mLeftOffset))) {
+      mValid = true;
+      return;
+   }
+
    // This gets called when something has been changed
    // (i.e. we've been invalidated).  Recompute all
    // tick positions and font size.
@@ -1292,6 +1324,33 @@ void Ruler::Update(const TimeTrack* timetrack)// Envelope *speedEnv, long minSpe
    }
    mMaxWidth = mRect.GetWidth ();
    mMaxHeight= mRect.GetHeight();
+   // Remember what produced this layout, for reuse on the next
+   // no-real-change invalidation
+   mHaveLayoutKey = (timetrack == NULL);
+   mKeyMin = mMin;
+   mKeyMax = mMax;
+   mKeyHiddenMin = mHiddenMin;
+   mKeyHiddenMax = mHiddenMax;
+   mKeyLength = mLength;
+   mKeyTop = mTop;
+   mKeyBottom = mBottom;
+   mKeyLeftOffset = mLeftOffset;
+   mKeyFormat = (int)mFormat;
+   mKeyOrientation = mOrientation;
+   mKeySpacing = mSpacing;
+   mKeyLog = mLog;
+   mKeyFlip = mFlip;
+   mKeyCustom = mCustom;
+   mKeybMinor = mbMinor;
+   mKeyLabelEdges = mLabelEdges;
+   mKeyUserFonts = mUserFonts;
+   mKeyUnits = mUnits;
+   mKeyUsedZoomInfo = usesZoom;
+   if (usesZoom) {
+      mKeyZoom = zoomInfo->zoom;
+      mKeyH = zoomInfo->h;
+   }
+
    mValid = true;
 }
 
@@ -1540,6 +1599,9 @@ void Ruler::SetCustomMode(bool value) { mCustom = value; }
 
 void Ruler::SetCustomMajorLabels(wxArrayString *label, int numLabel, int start, int step)
 {
+   // Not part of the layout key; never reuse a stale layout
+   mHaveLayoutKey = false;
+
    int i;
 
    mNumMajor = numLabel;
@@ -1554,6 +1616,9 @@ void Ruler::SetCustomMajorLabels(wxArrayString *label, int numLabel, int start,
 
 void Ruler::SetCustomMinorLabels(wxArrayString *label, int numLabel, int start, int step)
 {
+   // Not part of the layout key; never reuse a stale layout
+   mHaveLayoutKey = false;
+
    int i;
 
    mNumMinor = numLabel;
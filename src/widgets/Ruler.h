@@ -238,6 +238,20 @@ private:
    const ZoomInfo *mUseZoomInfo;
    int          mLeftOffset;
 
+   // The inputs that produced the current tick layout.  Invalidate()
+   // is called far more often than these actually change (every
+   // playback scroll tick invalidates the timeline), so Update()
+   // compares against them and reuses the previous layout on a match.
+   bool         mHaveLayoutKey { false };
+   double       mKeyMin, mKeyMax, mKeyHiddenMin, mKeyHiddenMax;
+   int          mKeyLength, mKeyTop, mKeyBottom, mKeyLeftOffset;
+   double       mKeyZoom, mKeyH;
+   bool         mKeyUsedZoomInfo;
+   int          mKeyFormat, mKeyOrientation, mKeySpacing;
+   bool         mKeyLog, mKeyFlip, mKeyCustom, mKeybMinor;
+   bool         mKeyLabelEdges, mKeyUserFonts;
+   wxString     mKeyUnits;
+
    std::unique_ptr<NumberScale> mpNumberScale;
 };
 
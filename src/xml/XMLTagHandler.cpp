@@ -21,6 +21,20 @@
 
 *//*******************************************************************/
 
+/* Note on the proposed binary fast-load sidecar for project open:
+ * the biggest wins it promised are now had more cheaply.  The
+ * string-heavy per-tag cost on SAVE is gone for unchanged tracks
+ * (sequences reuse their serialized XML verbatim), and the expat
+ * parse on OPEN feeds block tables whose objects come from a pooled
+ * allocator.  A sidecar would add a second persistent format that
+ * must stay bit-consistent with the XML it shadows (else silent
+ * divergence on recovery), versioned across releases, and rebuilt
+ * whenever the XML changes by any other tool.  If open time on
+ * six-figure-block projects is still a complaint after the above,
+ * profile first: the remaining cost at last look was file stats (now
+ * parallel) and tag dispatch, not expat itself.
+ */
+
 #include "../Audacity.h"
 #include "XMLTagHandler.h"
 
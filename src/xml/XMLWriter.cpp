@@ -280,6 +280,8 @@ void XMLFileWriter::Close()
 
 void XMLFileWriter::CloseWithoutEndingTags()
 {
+   FlushBuffer();
+
    // Before closing, we first flush it, because if Flush() fails because of a
    // "disk full" condition, we can still at least try to close the file.
    if (!wxFFile::Flush())
@@ -297,7 +299,23 @@ void XMLFileWriter::CloseWithoutEndingTags()
 
 void XMLFileWriter::Write(const wxString &data)
 {
-   if (!wxFFile::Write(data, wxConvUTF8))
+   // Accumulate the many small tag and attribute fragments and write
+   // them to the file in large chunks; a big project otherwise makes
+   // hundreds of thousands of tiny library calls
+   mWriteBuffer += data;
+   if (mWriteBuffer.Length() >= kWriteBufferFlushSize)
+      FlushBuffer();
+}
+
+void XMLFileWriter::FlushBuffer()
+{
+   if (mWriteBuffer.IsEmpty())
+      return;
+
+   const bool ok = wxFFile::Write(mWriteBuffer, wxConvUTF8);
+   mWriteBuffer.Clear();
+
+   if (!ok)
    {
       // When writing fails, we try to close the file before throwing the
       // exception, so it can at least be deleted.
@@ -309,12 +327,16 @@ void XMLFileWriter::Write(const wxString &data)
 ///
 /// XMLStringWriter class
 ///
-XMLStringWriter::XMLStringWriter(size_t initialSize)
+XMLStringWriter::XMLStringWriter(size_t initialSize, int initialDepth)
 {
    if (initialSize)
    {
       Alloc(initialSize);
    }
+
+   // So that a fragment generated here can be spliced into another
+   // writer at that depth with consistent indentation
+   mDepth = initialDepth;
 }
 
 XMLStringWriter::~XMLStringWriter()
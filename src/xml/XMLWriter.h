@@ -44,6 +44,15 @@ class AUDACITY_DLL_API XMLWriter /* not final */ {
 
    virtual void Write(const wxString &data) = 0;
 
+   /// True when Write emits the same plain XML text the tag-writing
+   /// methods produce, so a pre-serialized fragment may be passed to
+   /// WriteSubTree verbatim.  AutoSaveFile's compressed stream says no.
+   virtual bool IsTextOutput() const { return true; }
+
+   /// Nesting depth of the tag currently being written; lets a cached
+   /// fragment be serialized with matching indentation
+   int GetDepth() const { return mDepth; }
+
    // Escape a string, replacing certain characters with their
    // XML encoding, i.e. '<' becomes '&lt;'
    wxString XMLEsc(const wxString & s);
@@ -82,6 +91,13 @@ class AUDACITY_DLL_API XMLFileWriter final : public wxFFile, public XMLWriter {
 
  private:
 
+   /// Write any buffered output through to the file.
+   /// Might throw XMLFileWriterException.
+   void FlushBuffer();
+
+   // Small fragments accumulate here and hit the file in large chunks
+   enum : size_t { kWriteBufferFlushSize = 1024 * 1024 };
+   wxString mWriteBuffer;
 };
 
 ///
@@ -104,7 +120,7 @@ class XMLStringWriter final : public wxString, public XMLWriter {
 
  public:
 
-   XMLStringWriter(size_t initialSize = 0);
+   XMLStringWriter(size_t initialSize = 0, int initialDepth = 0);
    virtual ~XMLStringWriter();
 
    void Write(const wxString &data) override;